@@ -189,6 +189,14 @@ declare global {
          */
         captureImage(options: CaptureOptions): void;
 
+        /**
+         * Render the minimap of the current state of the map and save to disc.
+         * Only tiles that have changed since the previous capture are redrawn, so this is
+         * cheap enough to call periodically.
+         * @param options Options that control the capture and output file.
+         */
+        captureMiniMap(options: MiniMapCaptureOptions): void;
+
         /**
          * Gets the loaded object at the given index.
          * @param type The object type.
@@ -268,6 +276,12 @@ declare global {
         subscribe(hook: "action.location", callback: (e: ActionLocationArgs) => void): IDisposable;
         subscribe(hook: "guest.generation", callback: (id: number) => void): IDisposable;
 
+        /**
+         * Gets the number of times each plugin's hook callbacks have been called and the
+         * time spent in them, so that expensive plugins can be found.
+         */
+        getHookStats(): HookStats[];
+
         /**
          * Registers a function to be called every so often in realtime, specified by the given delay.
          * @param callback The function to call every time the delay has elapsed.
@@ -346,6 +360,25 @@ declare global {
         transparent?: boolean;
     }
 
+    interface MiniMapCaptureOptions {
+        /**
+         * A relative filename from the screenshot directory to save the capture as.
+         * By default, the filename will be automatically generated using the system date and time.
+         */
+        filename?: string;
+
+        /**
+         * Rotation of the map from 0 to 3.
+         */
+        rotation?: number;
+
+        /**
+         * Whether to colour the map like the people or the rides tab of the map window.
+         * Defaults to people.
+         */
+        type?: "peeps" | "rides";
+    }
+
     type ObjectType =
         "ride" |
         "small_scenery" |
@@ -367,6 +400,16 @@ declare global {
         "network.chat" | "network.action" | "network.join" | "network.leave" |
         "ride.ratings.calculate" | "action.location";
 
+    interface HookStats {
+        /** The name of the plugin that subscribed to the hook. */
+        readonly plugin: string;
+        readonly hook: HookType;
+        /** The number of times the plugin's callbacks for the hook have been called. */
+        readonly calls: number;
+        /** The total time spent in the plugin's callbacks for the hook, in milliseconds. */
+        readonly time: number;
+    }
+
     type ExpenditureType =
         "ride_construction" |
         "ride_runningcosts" |
@@ -563,6 +606,62 @@ declare global {
         getEntity(id: number): Entity;
         getAllEntities(type: EntityType): Entity[];
         getAllEntities(type: "peep"): Peep[];
+        getAllEntities(type: "guest"): Guest[];
+        getAllEntities(type: "staff"): Staff[];
+
+        /**
+         * Gets the properties of all entities of the given type as one typed array per property.
+         * This is much cheaper than getAllEntities when sampling many entities as no
+         * object is created per entity. The n-th value of each array belongs to the same entity.
+         */
+        getAllEntityColumns(type: EntityType): EntityColumns;
+        getAllEntityColumns(type: "peep" | "staff"): PeepColumns;
+        getAllEntityColumns(type: "guest"): GuestColumns;
+
+        /**
+         * Gets the raw data of all tiles in the given range in one call.
+         * See Tile.data for the format of the data.
+         * @param x The x coordinate of the first tile.
+         * @param y The y coordinate of the first tile.
+         * @param width The number of tiles in the x direction.
+         * @param height The number of tiles in the y direction.
+         */
+        getTileRangeData(x: number, y: number, width: number, height: number): TileRangeData;
+    }
+
+    interface EntityColumns {
+        readonly count: number;
+        readonly id: Uint16Array;
+        readonly x: Int16Array;
+        readonly y: Int16Array;
+        readonly z: Int16Array;
+    }
+
+    interface PeepColumns extends EntityColumns {
+        readonly energy: Uint8Array;
+    }
+
+    interface GuestColumns extends PeepColumns {
+        readonly happiness: Uint8Array;
+        readonly nausea: Uint8Array;
+        readonly hunger: Uint8Array;
+        readonly thirst: Uint8Array;
+        /**
+         * The ride the guest is queuing for or is on, 65535 if none.
+         */
+        readonly currentRide: Uint16Array;
+    }
+
+    interface TileRangeData {
+        /**
+         * The index of the first element of each tile within data, in rows starting from the first tile.
+         * The elements of tile i run up to, but not including, offsets[i + 1]. Each element is 16 bytes.
+         */
+        readonly offsets: Uint32Array;
+        /**
+         * The raw data of all elements in the range, see Tile.data.
+         */
+        readonly data: Uint8Array;
     }
 
     type TileElementType =
@@ -18,6 +18,7 @@
 #include <openrct2/OpenRCT2.h>
 #include <openrct2/audio/AudioChannel.h>
 #include <openrct2/audio/AudioMixer.h>
+#include <openrct2/audio/AudioMixing.h>
 #include <openrct2/audio/AudioSource.h>
 #include <openrct2/audio/audio.h>
 #include <openrct2/common.h>
@@ -30,6 +31,13 @@ namespace OpenRCT2::Audio
     class AudioMixerImpl final : public IAudioMixer
     {
     private:
+        struct CachedConverter
+        {
+            AudioFormat Format;
+            SDL_AudioCVT Cvt;
+            bool Valid;
+        };
+
         IAudioSource* _nullSource = nullptr;
 
         SDL_AudioDeviceID _deviceId = 0;
@@ -47,6 +55,7 @@ namespace OpenRCT2::Audio
         std::vector<uint8_t> _channelBuffer;
         std::vector<uint8_t> _convertBuffer;
         std::vector<uint8_t> _effectBuffer;
+        std::vector<CachedConverter> _converters;
 
     public:
         AudioMixerImpl()
@@ -80,6 +89,7 @@ namespace OpenRCT2::Audio
             _format.format = have.format;
             _format.channels = have.channels;
             _format.freq = have.freq;
+            _converters.clear();
 
             LoadAllSounds();
 
@@ -122,6 +132,7 @@ namespace OpenRCT2::Audio
             _convertBuffer.shrink_to_fit();
             _effectBuffer.clear();
             _effectBuffer.shrink_to_fit();
+            _converters.clear();
         }
 
         void Lock() override
@@ -262,21 +273,19 @@ namespace OpenRCT2::Audio
                 rate = channel->GetRate();
             }
 
-            bool mustConvert = false;
+            const SDL_AudioCVT* converter = nullptr;
             SDL_AudioCVT cvt;
             cvt.len_ratio = 1;
             AudioFormat streamformat = channel->GetFormat();
             if (streamformat != _format)
             {
-                if (SDL_BuildAudioCVT(
-                        &cvt, streamformat.format, streamformat.channels, streamformat.freq, _format.format, _format.channels,
-                        _format.freq)
-                    == -1)
+                converter = GetConverter(streamformat);
+                if (converter == nullptr)
                 {
                     // Unable to convert channel data
                     return;
                 }
-                mustConvert = true;
+                cvt = *converter;
             }
 
             // Read raw PCM from channel
@@ -288,7 +297,7 @@ namespace OpenRCT2::Audio
             // Convert data to required format if necessary
             void* buffer = nullptr;
             size_t bufferLen = 0;
-            if (mustConvert)
+            if (converter != nullptr)
             {
                 if (Convert(&cvt, _channelBuffer.data(), bytesRead))
                 {
@@ -322,14 +331,27 @@ namespace OpenRCT2::Audio
                 buffer = _effectBuffer.data();
             }
 
-            // Apply panning and volume
-            ApplyPan(channel, buffer, bufferLen, byteRate);
-            int32_t mixVolume = ApplyVolume(channel, buffer, bufferLen);
-
-            // Finally mix on to destination buffer
             size_t dstLength = std::min(length, bufferLen);
-            SDL_MixAudioFormat(
-                data, static_cast<const uint8_t*>(buffer), _format.format, static_cast<uint32_t>(dstLength), mixVolume);
+            if (_format.format == AUDIO_S16SYS)
+            {
+                // Pan, volume and mix in a single pass
+                MixGain startGain;
+                MixGain endGain;
+                GetChannelGain(channel, startGain, endGain);
+                MixS16(
+                    reinterpret_cast<int16_t*>(data), static_cast<const int16_t*>(buffer), dstLength / byteRate,
+                    _format.channels, startGain, endGain);
+            }
+            else
+            {
+                // Apply panning and volume
+                ApplyPan(channel, buffer, bufferLen, byteRate);
+                int32_t mixVolume = ApplyVolume(channel, buffer, bufferLen);
+
+                // Finally mix on to destination buffer
+                SDL_MixAudioFormat(
+                    data, static_cast<const uint8_t*>(buffer), _format.format, static_cast<uint32_t>(dstLength), mixVolume);
+            }
 
             channel->UpdateOldVolume();
         }
@@ -364,21 +386,13 @@ namespace OpenRCT2::Audio
 
         void ApplyPan(const IAudioChannel* channel, void* buffer, size_t len, size_t sampleSize)
         {
-            if (channel->GetPan() != 0.5f && _format.channels == 2)
+            if (channel->GetPan() != 0.5f && _format.channels == 2 && _format.format == AUDIO_U8)
             {
-                switch (_format.format)
-                {
-                    case AUDIO_S16SYS:
-                        EffectPanS16(channel, static_cast<int16_t*>(buffer), static_cast<int32_t>(len / sampleSize));
-                        break;
-                    case AUDIO_U8:
-                        EffectPanU8(channel, static_cast<uint8_t*>(buffer), static_cast<int32_t>(len / sampleSize));
-                        break;
-                }
+                EffectPanU8(channel, static_cast<uint8_t*>(buffer), static_cast<int32_t>(len / sampleSize));
             }
         }
 
-        int32_t ApplyVolume(const IAudioChannel* channel, void* buffer, size_t len)
+        float GetVolumeAdjust(const IAudioChannel* channel) const
         {
             float volumeAdjust = _volume;
             volumeAdjust *= gConfigSound.master_sound_enabled ? (static_cast<float>(gConfigSound.master_volume) / 100.0f)
@@ -401,6 +415,39 @@ namespace OpenRCT2::Audio
                     break;
             }
 
+            return volumeAdjust;
+        }
+
+        /**
+         * Gets the gain at the start and end of the next chunk for a channel, combining the
+         * volume fade with the pan so that both can be applied by a single mix kernel.
+         */
+        void GetChannelGain(const IAudioChannel* channel, MixGain& startGain, MixGain& endGain) const
+        {
+            float volumeAdjust = GetVolumeAdjust(channel);
+            int32_t startVolume = channel->GetOldVolume() * volumeAdjust;
+            int32_t endVolume = channel->GetVolume() * volumeAdjust;
+            if (channel->IsStopping())
+            {
+                endVolume = 0;
+            }
+
+            startGain.Left = static_cast<float>(startVolume) / MIXER_VOLUME_MAX;
+            startGain.Right = startGain.Left;
+            endGain.Left = static_cast<float>(endVolume) / MIXER_VOLUME_MAX;
+            endGain.Right = endGain.Left;
+            if (channel->GetPan() != 0.5f && _format.channels == 2)
+            {
+                startGain.Left *= channel->GetOldVolumeL();
+                startGain.Right *= channel->GetOldVolumeR();
+                endGain.Left *= channel->GetVolumeL();
+                endGain.Right *= channel->GetVolumeR();
+            }
+        }
+
+        int32_t ApplyVolume(const IAudioChannel* channel, void* buffer, size_t len)
+        {
+            float volumeAdjust = GetVolumeAdjust(channel);
             int32_t startVolume = channel->GetOldVolume() * volumeAdjust;
             int32_t endVolume = channel->GetVolume() * volumeAdjust;
             if (channel->IsStopping())
@@ -416,36 +463,14 @@ namespace OpenRCT2::Audio
 
                 // Fade between volume levels to smooth out sound and minimize clicks from sudden volume changes
                 int32_t fadeLength = static_cast<int32_t>(len) / _format.BytesPerSample();
-                switch (_format.format)
+                if (_format.format == AUDIO_U8)
                 {
-                    case AUDIO_S16SYS:
-                        EffectFadeS16(static_cast<int16_t*>(buffer), fadeLength, startVolume, endVolume);
-                        break;
-                    case AUDIO_U8:
-                        EffectFadeU8(static_cast<uint8_t*>(buffer), fadeLength, startVolume, endVolume);
-                        break;
+                    EffectFadeU8(static_cast<uint8_t*>(buffer), fadeLength, startVolume, endVolume);
                 }
             }
             return mixVolume;
         }
 
-        static void EffectPanS16(const IAudioChannel* channel, int16_t* data, int32_t length)
-        {
-            const float dt = 1.0f / static_cast<float>(length * 2.0f);
-            float volumeL = channel->GetOldVolumeL();
-            float volumeR = channel->GetOldVolumeR();
-            const float d_left = dt * (channel->GetVolumeL() - channel->GetOldVolumeL());
-            const float d_right = dt * (channel->GetVolumeR() - channel->GetOldVolumeR());
-
-            for (int32_t i = 0; i < length * 2; i += 2)
-            {
-                data[i + 0] = static_cast<int16_t>(volumeL * static_cast<float>(data[i + 0]));
-                data[i + 1] = static_cast<int16_t>(volumeR * static_cast<float>(data[i + 1]));
-                volumeL += d_left;
-                volumeR += d_right;
-            }
-        }
-
         static void EffectPanU8(const IAudioChannel* channel, uint8_t* data, int32_t length)
         {
             float volumeL = channel->GetVolumeL();
@@ -461,7 +486,7 @@ namespace OpenRCT2::Audio
             }
         }
 
-        static void EffectFadeS16(int16_t* data, int32_t length, int32_t startvolume, int32_t endvolume)
+        static void EffectFadeU8(uint8_t* data, int32_t length, int32_t startvolume, int32_t endvolume)
         {
             static_assert(SDL_MIX_MAXVOLUME == MIXER_VOLUME_MAX, "Max volume differs between OpenRCT2 and SDL2");
 
@@ -470,21 +495,30 @@ namespace OpenRCT2::Audio
             for (int32_t i = 0; i < length; i++)
             {
                 float t = static_cast<float>(i) / length;
-                data[i] = static_cast<int16_t>(data[i] * ((1.0f - t) * startvolume_f + t * endvolume_f));
+                data[i] = static_cast<uint8_t>(data[i] * ((1.0f - t) * startvolume_f + t * endvolume_f));
             }
         }
 
-        static void EffectFadeU8(uint8_t* data, int32_t length, int32_t startvolume, int32_t endvolume)
+        /**
+         * Gets a converter from the given format to the device format. Converters are cached
+         * until the device is reopened so they are not rebuilt for every chunk.
+         */
+        const SDL_AudioCVT* GetConverter(const AudioFormat& srcFormat)
         {
-            static_assert(SDL_MIX_MAXVOLUME == MIXER_VOLUME_MAX, "Max volume differs between OpenRCT2 and SDL2");
-
-            float startvolume_f = static_cast<float>(startvolume) / SDL_MIX_MAXVOLUME;
-            float endvolume_f = static_cast<float>(endvolume) / SDL_MIX_MAXVOLUME;
-            for (int32_t i = 0; i < length; i++)
+            auto it = std::find_if(_converters.begin(), _converters.end(), [&srcFormat](const CachedConverter& converter) {
+                return converter.Format == srcFormat;
+            });
+            if (it == _converters.end())
             {
-                float t = static_cast<float>(i) / length;
-                data[i] = static_cast<uint8_t>(data[i] * ((1.0f - t) * startvolume_f + t * endvolume_f));
+                CachedConverter converter{};
+                converter.Format = srcFormat;
+                converter.Valid = SDL_BuildAudioCVT(
+                                      &converter.Cvt, srcFormat.format, srcFormat.channels, srcFormat.freq, _format.format,
+                                      _format.channels, _format.freq)
+                    != -1;
+                it = _converters.insert(_converters.end(), converter);
             }
+            return it->Valid ? &it->Cvt : nullptr;
         }
 
         bool Convert(SDL_AudioCVT* cvt, const void* src, size_t len)
@@ -16,6 +16,7 @@
 #include <openrct2/config/Config.h>
 #include <openrct2/drawing/Drawing.h>
 #include <openrct2/localisation/Localisation.h>
+#include <openrct2/peep/GuestAggregates.h>
 #include <openrct2/ride/RideData.h>
 #include <openrct2/scenario/Scenario.h>
 #include <openrct2/sprites.h>
@@ -86,26 +87,7 @@ private:
         GuestsThinkingAbout,
     };
 
-    struct FilterArguments
-    {
-        uint8_t args[12]{};
-
-        rct_string_id GetFirstStringId()
-        {
-            rct_string_id firstStrId{};
-            std::memcpy(&firstStrId, args, sizeof(firstStrId));
-            return firstStrId;
-        }
-
-        bool operator==(const FilterArguments& other)
-        {
-            return std::memcmp(args, other.args, sizeof(args)) == 0;
-        }
-        bool operator!=(const FilterArguments& other)
-        {
-            return !(*this == other);
-        }
-    };
+    using FilterArguments = GuestAggregateKey;
 
     struct GuestGroup
     {
@@ -257,8 +239,15 @@ public:
         }
     }
 
+    void OnClose() override
+    {
+        GetGuestAggregator().Reset();
+    }
+
     void OnUpdate() override
     {
+        GetGuestAggregator().Update();
+
         if (_lastFindGroupsWait != 0)
         {
             _lastFindGroupsWait--;
@@ -378,6 +367,7 @@ public:
         {
             case WIDX_PAGE_DROPDOWN_BUTTON:
                 _selectedPage = dropdownIndex;
+                SortPage();
                 Invalidate();
                 break;
             case WIDX_INFO_TYPE_DROPDOWN_BUTTON:
@@ -632,7 +622,7 @@ public:
                 format_string(item.Name, sizeof(item.Name), STR_STRINGID, ft.Data());
             }
 
-            std::sort(_guestList.begin(), _guestList.end(), GetGuestCompareFunc());
+            SortPage();
         }
     }
 
@@ -819,19 +809,6 @@ private:
         return true;
     }
 
-    GuestGroup& FindOrAddGroup(FilterArguments&& arguments)
-    {
-        auto foundGroup = std::find_if(
-            std::begin(_groups), std::end(_groups), [&arguments](GuestGroup& group) { return group.Arguments == arguments; });
-        if (foundGroup != std::end(_groups))
-        {
-            return *foundGroup;
-        }
-        auto& newGroup = _groups.emplace_back();
-        newGroup.Arguments = arguments;
-        return newGroup;
-    }
-
     void RefreshGroups()
     {
         _lastFindGroupsTick = floor2(gScenarioTicks, 256);
@@ -839,62 +816,97 @@ private:
         _lastFindGroupsWait = 320;
         _groups.clear();
 
+        // The aggregator keeps the guest count of every group up to date, so only the largest groups need picking out
+        auto& aggregator = GetGuestAggregator();
+        if (!aggregator.IsActive())
+        {
+            aggregator.Rebuild();
+        }
+        auto aggregateType = GetAggregateType(_selectedView);
+        const auto& aggregateGroups = aggregator.GetGroups(aggregateType);
+
+        std::vector<uint32_t> groupIndices;
+        for (uint32_t i = 0; i < aggregateGroups.size(); i++)
+        {
+            const auto& aggregateGroup = aggregateGroups[i];
+            // Skip the empty group (basically guests with no thoughts)
+            if (aggregateGroup.NumGuests != 0 && aggregateGroup.Key.GetFirstStringId() != STR_EMPTY)
+            {
+                groupIndices.push_back(i);
+            }
+        }
+
+        // Sort groups by number of guests, only up to MaxGroups are shown
+        auto numGroups = std::min(groupIndices.size(), MaxGroups);
+        std::partial_sort(
+            groupIndices.begin(), groupIndices.begin() + numGroups, groupIndices.end(),
+            [&aggregateGroups](uint32_t a, uint32_t b) { return aggregateGroups[a].NumGuests > aggregateGroups[b].NumGuests; });
+        groupIndices.resize(numGroups);
+
+        std::vector<uint32_t> groupPositions(aggregateGroups.size(), GuestAggregator::NoGroup);
+        for (uint32_t i = 0; i < groupIndices.size(); i++)
+        {
+            auto& group = _groups.emplace_back();
+            group.Arguments = aggregateGroups[groupIndices[i]].Key;
+            groupPositions[groupIndices[i]] = i;
+        }
+
+        // Faces are not aggregated as guest happiness changes constantly, gathering them only needs the cached group
         for (auto peep : EntityList<Guest>())
         {
-            if (peep->OutsideOfPark)
+            auto groupIndex = aggregator.GetGroupIndex(peep->sprite_index, aggregateType);
+            if (groupIndex == GuestAggregator::NoGroup || groupPositions[groupIndex] == GuestAggregator::NoGroup)
                 continue;
 
-            auto& group = FindOrAddGroup(GetArgumentsFromPeep(*peep, _selectedView));
+            auto& group = _groups[groupPositions[groupIndex]];
             if (group.NumGuests < std::size(group.Faces))
             {
                 group.Faces[group.NumGuests] = get_peep_face_sprite_small(peep) - SPR_PEEP_SMALL_FACE_VERY_VERY_UNHAPPY;
             }
             group.NumGuests++;
         }
+    }
 
-        // Remove empty group (basically guests with no thoughts)
-        auto foundGroup = std::find_if(std::begin(_groups), std::end(_groups), [](GuestGroup& group) {
-            return group.Arguments.GetFirstStringId() == STR_EMPTY;
-        });
-        if (foundGroup != std::end(_groups))
+    /**
+     * Sorts the guests on the selected page, the other pages are only partitioned from it.
+     */
+    void SortPage()
+    {
+        auto compareFunc = GetGuestCompareFunc();
+        if (_guestList.size() <= static_cast<size_t>(GUESTS_PER_PAGE))
         {
-            _groups.erase(foundGroup);
+            std::sort(_guestList.begin(), _guestList.end(), compareFunc);
+            return;
         }
 
-        // Sort groups by number of guests
-        std::sort(
-            _groups.begin(), _groups.end(), [](const GuestGroup& a, const GuestGroup& b) { return a.NumGuests > b.NumGuests; });
-
-        // Remove up to MaxGroups
-        if (_groups.size() > MaxGroups)
+        auto pageBegin = _guestList.begin() + std::min(_selectedPage * GUESTS_PER_PAGE, _guestList.size());
+        auto pageEnd = _guestList.begin() + std::min((_selectedPage + 1) * GUESTS_PER_PAGE, _guestList.size());
+        if (pageBegin != _guestList.begin())
+        {
+            std::nth_element(_guestList.begin(), pageBegin, _guestList.end(), compareFunc);
+        }
+        if (pageEnd != _guestList.end())
         {
-            _groups.resize(MaxGroups);
+            std::nth_element(pageBegin, pageEnd, _guestList.end(), compareFunc);
         }
+        std::sort(pageBegin, pageEnd, compareFunc);
     }
 
-    /**
-     * Calculates a hash value (arguments) for comparing peep actions/thoughts
-     */
     static FilterArguments GetArgumentsFromPeep(const Guest& peep, GuestViewType type)
     {
-        FilterArguments result;
-        Formatter ft(result.args);
+        return guest_aggregate_get_key(peep, GetAggregateType(type));
+    }
+
+    static constexpr GuestAggregateType GetAggregateType(GuestViewType type)
+    {
         switch (type)
         {
+            default:
             case GuestViewType::Actions:
-                peep.FormatActionTo(ft);
-                break;
+                return GuestAggregateType::Actions;
             case GuestViewType::Thoughts:
-            {
-                const auto& thought = peep.Thoughts[0];
-                if (thought.type != PeepThoughtType::None && thought.freshness <= 5)
-                {
-                    peep_thought_set_format_args(&thought, ft);
-                }
-                break;
-            }
+                return GuestAggregateType::Thoughts;
         }
-        return result;
     }
 
     static constexpr rct_string_id GetViewName(GuestViewType type)
@@ -31,25 +31,14 @@
 #include <openrct2/world/EntityList.h>
 #include <openrct2/world/Entrance.h>
 #include <openrct2/world/Footpath.h>
+#include <openrct2/world/MiniMap.h>
 #include <openrct2/world/Scenery.h>
 #include <openrct2/world/Sprite.h>
 #include <openrct2/world/Surface.h>
+#include <memory>
 #include <vector>
 
-static constexpr uint16_t MapColour2(uint8_t colourA, uint8_t colourB)
-{
-    return (colourA << 8) | colourB;
-}
-static constexpr uint16_t MapColour(uint8_t colour)
-{
-    return MapColour2(colour, colour);
-}
-static constexpr uint16_t MapColourUnowned(uint16_t colour)
-{
-    return MapColour2((colour & 0xFF00) >> 8, PALETTE_INDEX_10);
-}
-
-constexpr int32_t MAP_WINDOW_MAP_SIZE = MAXIMUM_MAP_SIZE_TECHNICAL * 2;
+constexpr int32_t MAP_WINDOW_MAP_SIZE = MINI_MAP_SIZE;
 
 static constexpr const rct_string_id WINDOW_TITLE = STR_MAP_LABEL;
 static constexpr const int32_t WH = 259;
@@ -129,18 +118,6 @@ static constexpr const ScreenCoordsXY MiniMapOffsets[] = {
     {                              0 - 8,     MAXIMUM_MAP_SIZE_TECHNICAL }
 };
 
-/** rct2: 0x00981BCC */
-static constexpr const uint16_t RideKeyColours[] = {
-    MapColour(PALETTE_INDEX_61),   // COLOUR_KEY_RIDE
-    MapColour(PALETTE_INDEX_42),   // COLOUR_KEY_FOOD
-    MapColour(PALETTE_INDEX_20),   // COLOUR_KEY_DRINK
-    MapColour(PALETTE_INDEX_209),  // COLOUR_KEY_SOUVENIR
-    MapColour(PALETTE_INDEX_136),  // COLOUR_KEY_KIOSK
-    MapColour(PALETTE_INDEX_102),  // COLOUR_KEY_FIRST_AID
-    MapColour(PALETTE_INDEX_55),   // COLOUR_KEY_CASH_MACHINE
-    MapColour(PALETTE_INDEX_161),  // COLOUR_KEY_TOILETS
-};
-
 static void window_map_close(rct_window *w);
 static void window_map_resize(rct_window *w);
 static void window_map_mouseup(rct_window *w, rct_widgetindex widgetIndex);
@@ -181,11 +158,8 @@ static rct_window_event_list window_map_events([](auto& events)
 /** rct2: 0x00F1AD61 */
 static uint8_t _activeTool;
 
-/** rct2: 0x00F1AD6C */
-static uint32_t _currentLine;
-
 /** rct2: 0x00F1AD68 */
-static std::vector<uint8_t> _mapImageData;
+static std::unique_ptr<MiniMap> _miniMap;
 
 static uint16_t _landRightsToolSize;
 
@@ -206,7 +180,6 @@ static void window_map_place_park_entrance_tool_down(const ScreenCoordsXY& scree
 static void window_map_set_peep_spawn_tool_down(const ScreenCoordsXY& screenCoords);
 static void map_window_increase_map_size();
 static void map_window_decrease_map_size();
-static void map_window_set_pixels(rct_window* w);
 
 static CoordsXY map_window_screen_to_map(ScreenCoordsXY screenCoords);
 
@@ -229,7 +202,7 @@ rct_window* window_map_open()
 
     try
     {
-        _mapImageData.resize(MAP_WINDOW_MAP_SIZE * MAP_WINDOW_MAP_SIZE);
+        _miniMap = std::make_unique<MiniMap>();
     }
     catch (const std::bad_alloc&)
     {
@@ -283,8 +256,7 @@ void window_map_reset()
  */
 static void window_map_close(rct_window* w)
 {
-    _mapImageData.clear();
-    _mapImageData.shrink_to_fit();
+    _miniMap = nullptr;
     if ((input_test_flag(INPUT_FLAG_TOOL_ACTIVE)) && gCurrentToolWidget.window_classification == w->classification
         && gCurrentToolWidget.window_number == w->number)
     {
@@ -446,8 +418,9 @@ static void window_map_update(rct_window* w)
         window_map_centre_on_view_point();
     }
 
-    for (int32_t i = 0; i < 16; i++)
-        map_window_set_pixels(w);
+    // Only tiles that have changed are redrawn
+    _miniMap->SetType(w->selected_tab == PAGE_PEEPS ? MiniMapType::Peeps : MiniMapType::Rides);
+    _miniMap->Update();
 
     w->Invalidate();
 
@@ -848,10 +821,10 @@ static void window_map_paint(rct_window* w, rct_drawpixelinfo* dpi)
                 STR_MAP_INFO_KIOSK, STR_MAP_FIRST_AID,  STR_MAP_CASH_MACHINE, STR_MAP_TOILET,
             };
 
-            for (uint32_t i = 0; i < std::size(RideKeyColours); i++)
+            for (uint32_t i = 0; i < std::size(MiniMapRideKeyColours); i++)
             {
                 gfx_fill_rect(
-                    dpi, { screenCoords + ScreenCoordsXY{ 0, 2 }, screenCoords + ScreenCoordsXY{ 6, 8 } }, RideKeyColours[i]);
+                    dpi, { screenCoords + ScreenCoordsXY{ 0, 2 }, screenCoords + ScreenCoordsXY{ 6, 8 } }, MiniMapRideKeyColours[i]);
                 DrawTextBasic(dpi, screenCoords + ScreenCoordsXY{ LIST_ROW_HEIGHT, 0 }, mapLabels[i], w);
                 screenCoords.y += LIST_ROW_HEIGHT;
                 if (i == 3)
@@ -878,7 +851,7 @@ static void window_map_scrollpaint(rct_window* w, rct_drawpixelinfo* dpi, int32_
     gfx_clear(dpi, PALETTE_INDEX_10);
 
     rct_g1_element g1temp = {};
-    g1temp.offset = _mapImageData.data();
+    g1temp.offset = const_cast<uint8_t*>(_miniMap->GetImageData());
     g1temp.width = MAP_WINDOW_MAP_SIZE;
     g1temp.height = MAP_WINDOW_MAP_SIZE;
     g1temp.x_offset = -8;
@@ -904,8 +877,8 @@ static void window_map_scrollpaint(rct_window* w, rct_drawpixelinfo* dpi, int32_
  */
 static void window_map_init_map()
 {
-    std::fill(_mapImageData.begin(), _mapImageData.end(), PALETTE_INDEX_10);
-    _currentLine = 0;
+    _miniMap->SetRotation(get_current_rotation());
+    _miniMap->InvalidateAll();
 }
 
 /**
@@ -1405,205 +1378,6 @@ static void map_window_decrease_map_size()
     gfx_invalidate_screen();
 }
 
-static constexpr const uint16_t WaterColour = MapColour(PALETTE_INDEX_195);
-static constexpr const uint16_t TerrainColour[] = {
-    MapColour(PALETTE_INDEX_73),                     // TERRAIN_GRASS
-    MapColour(PALETTE_INDEX_40),                     // TERRAIN_SAND
-    MapColour(PALETTE_INDEX_108),                    // TERRAIN_DIRT
-    MapColour(PALETTE_INDEX_12),                     // TERRAIN_ROCK
-    MapColour(PALETTE_INDEX_62),                     // TERRAIN_MARTIAN
-    MapColour2(PALETTE_INDEX_10, PALETTE_INDEX_16),  // TERRAIN_CHECKERBOARD
-    MapColour2(PALETTE_INDEX_73, PALETTE_INDEX_108), // TERRAIN_GRASS_CLUMPS
-    MapColour(PALETTE_INDEX_141),                    // TERRAIN_ICE
-    MapColour2(PALETTE_INDEX_172, PALETTE_INDEX_10), // TERRAIN_GRID_RED
-    MapColour2(PALETTE_INDEX_54, PALETTE_INDEX_10),  // TERRAIN_GRID_YELLOW
-    MapColour2(PALETTE_INDEX_162, PALETTE_INDEX_10), // TERRAIN_GRID_BLUE
-    MapColour2(PALETTE_INDEX_102, PALETTE_INDEX_10), // TERRAIN_GRID_GREEN
-    MapColour(PALETTE_INDEX_111),                    // TERRAIN_SAND_DARK
-    MapColour(PALETTE_INDEX_222),                    // TERRAIN_SAND_LIGHT
-};
-
-static constexpr const uint16_t ElementTypeMaskColour[] = {
-    0xFFFF, // TILE_ELEMENT_TYPE_SURFACE
-    0x0000, // TILE_ELEMENT_TYPE_PATH
-    0x00FF, // TILE_ELEMENT_TYPE_TRACK
-    0xFF00, // TILE_ELEMENT_TYPE_SMALL_SCENERY
-    0x0000, // TILE_ELEMENT_TYPE_ENTRANCE
-    0xFFFF, // TILE_ELEMENT_TYPE_WALL
-    0x0000, // TILE_ELEMENT_TYPE_LARGE_SCENERY
-    0xFFFF, // TILE_ELEMENT_TYPE_BANNER
-    0x0000, // TILE_ELEMENT_TYPE_CORRUPT
-};
-
-static constexpr const uint16_t ElementTypeAddColour[] = {
-    MapColour(PALETTE_INDEX_0),                     // TILE_ELEMENT_TYPE_SURFACE
-    MapColour(PALETTE_INDEX_17),                    // TILE_ELEMENT_TYPE_PATH
-    MapColour2(PALETTE_INDEX_183, PALETTE_INDEX_0), // TILE_ELEMENT_TYPE_TRACK
-    MapColour2(PALETTE_INDEX_0, PALETTE_INDEX_99),  // TILE_ELEMENT_TYPE_SMALL_SCENERY
-    MapColour(PALETTE_INDEX_186),                   // TILE_ELEMENT_TYPE_ENTRANCE
-    MapColour(PALETTE_INDEX_0),                     // TILE_ELEMENT_TYPE_WALL
-    MapColour(PALETTE_INDEX_99),                    // TILE_ELEMENT_TYPE_LARGE_SCENERY
-    MapColour(PALETTE_INDEX_0),                     // TILE_ELEMENT_TYPE_BANNER
-    MapColour(PALETTE_INDEX_68),                    // TILE_ELEMENT_TYPE_CORRUPT
-};
-
-static uint16_t map_window_get_pixel_colour_peep(const CoordsXY& c)
-{
-    auto* surfaceElement = map_get_surface_element_at(c);
-    if (surfaceElement == nullptr)
-        return 0;
-    uint16_t colour = TerrainColour[surfaceElement->GetSurfaceStyle()];
-    if (surfaceElement->GetWaterHeight() > 0)
-        colour = WaterColour;
-
-    if (!(surfaceElement->GetOwnership() & OWNERSHIP_OWNED))
-        colour = MapColourUnowned(colour);
-
-    const int32_t maxSupportedTileElementType = static_cast<int32_t>(std::size(ElementTypeAddColour));
-    auto tileElement = reinterpret_cast<TileElement*>(surfaceElement);
-    while (!(tileElement++)->IsLastForTile())
-    {
-        if (tileElement->IsGhost())
-        {
-            colour = MapColour(PALETTE_INDEX_21);
-            break;
-        }
-
-        int32_t tileElementType = tileElement->GetType() >> 2;
-        if (tileElementType >= maxSupportedTileElementType)
-        {
-            tileElementType = TILE_ELEMENT_TYPE_CORRUPT >> 2;
-        }
-        colour &= ElementTypeMaskColour[tileElementType];
-        colour |= ElementTypeAddColour[tileElementType];
-    }
-
-    return colour;
-}
-
-static uint16_t map_window_get_pixel_colour_ride(const CoordsXY& c)
-{
-    Ride* ride;
-    uint16_t colourA = 0;                           // highlight colour
-    uint16_t colourB = MapColour(PALETTE_INDEX_13); // surface colour (dark grey)
-
-    // as an improvement we could use first_element to show underground stuff?
-    TileElement* tileElement = reinterpret_cast<TileElement*>(map_get_surface_element_at(c));
-    do
-    {
-        if (tileElement == nullptr)
-            break;
-
-        if (tileElement->IsGhost())
-        {
-            colourA = MapColour(PALETTE_INDEX_21);
-            break;
-        }
-
-        switch (tileElement->GetType())
-        {
-            case TILE_ELEMENT_TYPE_SURFACE:
-                if (tileElement->AsSurface()->GetWaterHeight() > 0)
-                    // Why is this a different water colour as above (195)?
-                    colourB = MapColour(PALETTE_INDEX_194);
-                if (!(tileElement->AsSurface()->GetOwnership() & OWNERSHIP_OWNED))
-                    colourB = MapColourUnowned(colourB);
-                break;
-            case TILE_ELEMENT_TYPE_PATH:
-                colourA = MapColour(PALETTE_INDEX_14); // lighter grey
-                break;
-            case TILE_ELEMENT_TYPE_ENTRANCE:
-                if (tileElement->AsEntrance()->GetEntranceType() == ENTRANCE_TYPE_PARK_ENTRANCE)
-                    break;
-                ride = get_ride(tileElement->AsEntrance()->GetRideIndex());
-                if (ride != nullptr)
-                {
-                    const auto& colourKey = ride->GetRideTypeDescriptor().ColourKey;
-                    colourA = RideKeyColours[static_cast<size_t>(colourKey)];
-                }
-                break;
-            case TILE_ELEMENT_TYPE_TRACK:
-                ride = get_ride(tileElement->AsTrack()->GetRideIndex());
-                if (ride != nullptr)
-                {
-                    const auto& colourKey = ride->GetRideTypeDescriptor().ColourKey;
-                    colourA = RideKeyColours[static_cast<size_t>(colourKey)];
-                }
-
-                break;
-        }
-    } while (!(tileElement++)->IsLastForTile());
-
-    if (colourA != 0)
-        return colourA;
-
-    return colourB;
-}
-
-static void map_window_set_pixels(rct_window* w)
-{
-    uint16_t colour = 0;
-    int32_t x = 0, y = 0, dx = 0, dy = 0;
-
-    int32_t pos = (_currentLine * (MAP_WINDOW_MAP_SIZE - 1)) + MAXIMUM_MAP_SIZE_TECHNICAL - 1;
-    auto destinationPosition = ScreenCoordsXY{ pos % MAP_WINDOW_MAP_SIZE, pos / MAP_WINDOW_MAP_SIZE };
-    auto destination = _mapImageData.data() + (destinationPosition.y * MAP_WINDOW_MAP_SIZE) + destinationPosition.x;
-    switch (get_current_rotation())
-    {
-        case 0:
-            x = _currentLine * COORDS_XY_STEP;
-            y = 0;
-            dx = 0;
-            dy = COORDS_XY_STEP;
-            break;
-        case 1:
-            x = MAXIMUM_TILE_START_XY;
-            y = _currentLine * COORDS_XY_STEP;
-            dx = -COORDS_XY_STEP;
-            dy = 0;
-            break;
-        case 2:
-            x = MAXIMUM_MAP_SIZE_BIG - ((_currentLine + 1) * COORDS_XY_STEP);
-            y = MAXIMUM_TILE_START_XY;
-            dx = 0;
-            dy = -COORDS_XY_STEP;
-            break;
-        case 3:
-            x = 0;
-            y = MAXIMUM_MAP_SIZE_BIG - ((_currentLine + 1) * COORDS_XY_STEP);
-            dx = COORDS_XY_STEP;
-            dy = 0;
-            break;
-    }
-
-    for (int32_t i = 0; i < MAXIMUM_MAP_SIZE_TECHNICAL; i++)
-    {
-        if (x > 0 && y > 0 && x < gMapSizeUnits && y < gMapSizeUnits)
-        {
-            switch (w->selected_tab)
-            {
-                case PAGE_PEEPS:
-                    colour = map_window_get_pixel_colour_peep({ x, y });
-                    break;
-                case PAGE_RIDES:
-                    colour = map_window_get_pixel_colour_ride({ x, y });
-                    break;
-            }
-            destination[0] = (colour >> 8) & 0xFF;
-            destination[1] = colour;
-        }
-        x += dx;
-        y += dy;
-
-        destinationPosition.x++;
-        destinationPosition.y++;
-        destination = _mapImageData.data() + (destinationPosition.y * MAP_WINDOW_MAP_SIZE) + destinationPosition.x;
-    }
-    _currentLine++;
-    if (_currentLine >= MAXIMUM_MAP_SIZE_TECHNICAL)
-        _currentLine = 0;
-}
-
 static CoordsXY map_window_screen_to_map(ScreenCoordsXY screenCoords)
 {
     screenCoords.x = ((screenCoords.x + 8) - MAXIMUM_MAP_SIZE_TECHNICAL) / 2;
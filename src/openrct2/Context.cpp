@@ -37,6 +37,7 @@
 #include "core/MemoryStream.h"
 #include "core/Path.hpp"
 #include "core/String.hpp"
+#include "core/Trace.h"
 #include "drawing/IDrawingEngine.h"
 #include "drawing/LightFX.h"
 #include "interface/Chat.h"
@@ -181,6 +182,9 @@ namespace OpenRCT2
             Audio::Close();
             config_release();
 
+            // Writes the trace if one was started with --trace
+            Trace::Stop();
+
             Instance = nullptr;
         }
 
@@ -19,6 +19,7 @@
 #include "ReplayManager.h"
 #include "actions/GameAction.h"
 #include "config/Config.h"
+#include "core/Trace.h"
 #include "interface/Screenshot.h"
 #include "localisation/Date.h"
 #include "localisation/Localisation.h"
@@ -41,6 +42,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include <iterator>
 
 using namespace OpenRCT2;
 using namespace OpenRCT2::Scripting;
@@ -166,7 +168,7 @@ void GameState::Update()
     // Update the game one or more times
     for (uint32_t i = 0; i < numUpdates; i++)
     {
-        UpdateLogic();
+        UpdateLogic(network_get_logic_timings());
         if (gGameSpeed == 1)
         {
             if (input_get_state() == InputState::Reset || input_get_state() == InputState::Normal)
@@ -231,11 +233,58 @@ void GameState::Update()
     gInUpdateCode = false;
 }
 
+// In the same order as LogicTimePart
+static constexpr const char* LogicTimePartNames[] = {
+    "NetworkUpdate",
+    "Date",
+    "Scenario",
+    "Climate",
+    "MapTiles",
+    "MapStashProvisionalElements",
+    "MapPathWideFlags",
+    "Peep",
+    "MapRestoreProvisionalElements",
+    "Vehicle",
+    "Misc",
+    "Ride",
+    "Park",
+    "Research",
+    "RideRatings",
+    "RideMeasurments",
+    "News",
+    "MapAnimation",
+    "Sounds",
+    "GameActions",
+    "NetworkFlush",
+    "Scripts",
+};
+static_assert(std::size(LogicTimePartNames) == LOGIC_TIME_PART_COUNT);
+
+const char* OpenRCT2::GetLogicTimePartName(LogicTimePart part)
+{
+    return LogicTimePartNames[static_cast<size_t>(part)];
+}
+
 void GameState::UpdateLogic(LogicTimings* timings)
 {
+    TRACE_SCOPE("UpdateLogic");
+
     auto start_time = std::chrono::high_resolution_clock::now();
 
-    auto report_time = [timings, start_time](LogicTimePart part) {
+#ifndef DISABLE_TRACING
+    // Each part is traced from where the previous one finished
+    auto part_start_time = Trace::IsRecording() ? Trace::Clock::now() : Trace::Clock::time_point{};
+#endif
+
+    auto report_time = [&](LogicTimePart part) {
+#ifndef DISABLE_TRACING
+        if (Trace::IsRecording())
+        {
+            auto now = Trace::Clock::now();
+            Trace::RecordEvent(GetLogicTimePartName(part), part_start_time, now);
+            part_start_time = now;
+        }
+#endif
         if (timings != nullptr)
         {
             timings->TimingInfo[part][timings->CurrentIdx] = std::chrono::high_resolution_clock::now() - start_time;
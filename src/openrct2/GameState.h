@@ -47,6 +47,10 @@ namespace OpenRCT2
         Scripts,
     };
 
+    constexpr size_t LOGIC_TIME_PART_COUNT = static_cast<size_t>(LogicTimePart::Scripts) + 1;
+
+    const char* GetLogicTimePartName(LogicTimePart part);
+
     // ~6.5s at 40Hz
     constexpr size_t LOGIC_UPDATE_MEASUREMENTS_COUNT = 256;
 
@@ -11,6 +11,7 @@
 
 #include "Context.h"
 #include "Game.h"
+#include "GameState.h"
 #include "GameStateSnapshots.h"
 #include "OpenRCT2.h"
 #include "ParkImporter.h"
@@ -24,6 +25,9 @@
 #include "actions/TrackPlaceAction.h"
 #include "config/Config.h"
 #include "core/DataSerialiser.h"
+#include "core/File.h"
+#include "core/FileStream.h"
+#include "core/JobPool.h"
 #include "core/Path.hpp"
 #include "management/NewsItem.h"
 #include "object/ObjectManager.h"
@@ -34,6 +38,7 @@
 #include "world/Sprite.h"
 #include "zlib.h"
 
+#include <atomic>
 #include <chrono>
 #include <memory>
 #include <vector>
@@ -90,17 +95,184 @@ namespace OpenRCT2
         uint64_t timeRecorded; // Posix Time.
         uint32_t tickStart;    // First tick of replay.
         uint32_t tickEnd;      // Last tick of replay.
+        uint32_t parkTick;     // Tick the park data was saved at, later than tickStart when loaded from a keyframe.
         std::multiset<ReplayCommand> commands;
         std::vector<std::pair<uint32_t, rct_sprite_checksum>> checksums;
         uint32_t checksumIndex;
         OpenRCT2::MemoryStream gameStateSnapshots;
+        // Commands and checksums already written out while recording
+        uint32_t numCommandsWritten = 0;
+        uint32_t numChecksumsWritten = 0;
+    };
+
+    enum class ReplayChunkType : uint8_t
+    {
+        Header,   // Park, parameters and the snapshot playback starts from.
+        Records,  // Commands and checksums of a range of ticks.
+        End,      // Last tick and final snapshot, missing if the recording was cut short.
+        Index,    // Every chunk before it, followed by the trailer.
+        Keyframe, // Park, parameters and cheats at a tick playback can seek to.
+    };
+
+    struct ReplayChunkIndexEntry
+    {
+        ReplayChunkType type;
+        uint32_t firstTick;
+        uint32_t lastTick;
+        uint64_t offset;
+    };
+
+    struct ReplayChunkHeader
+    {
+        ReplayChunkType type;
+        uint32_t firstTick;
+        uint32_t lastTick;
+        uint32_t uncompressedSize;
+        uint32_t compressedSize;
+    };
+
+    // Magic and version.
+    static constexpr uint64_t ReplayFileHeaderSize = 4 + 2;
+    // Type, first tick, last tick, uncompressed size and compressed size.
+    static constexpr uint64_t ReplayChunkHeaderSize = 1 + 4 + 4 + 4 + 4;
+    // Offset of the index chunk and the index magic.
+    static constexpr uint64_t ReplayTrailerSize = 8 + 4;
+    static constexpr uint32_t ReplayIndexMagic = 0x4943524F; // ORCI.
+
+    static constexpr int ReplayCompressionLevel = 9;
+
+    /**
+     * Writes a recording as a stream of chunks that are each compressed on their own. Compressing and writing is done on a
+     * background thread, and every chunk is flushed once written so a recording that is cut short can still be played up
+     * to its last complete chunk. The file ends with an index of all chunks and a trailer pointing at it.
+     */
+    class ReplayChunkWriter
+    {
+    private:
+        FILE* _fp = nullptr;
+        JobPool _jobs{ 1 };
+        std::atomic<bool> _failed{ false };
+
+        // Only used by the background thread once the file is open.
+        uint64_t _offset = 0;
+        std::vector<ReplayChunkIndexEntry> _index;
+
+    public:
+        ~ReplayChunkWriter()
+        {
+            Close(false);
+        }
+
+        bool Open(const std::string& path, uint32_t magic, uint16_t version)
+        {
+            _fp = fopen(path.c_str(), "wb");
+            if (_fp == nullptr)
+                return false;
+
+            DataSerialiser fileSerialiser(true);
+            fileSerialiser << magic;
+            fileSerialiser << version;
+            Write(fileSerialiser.GetStream());
+            return !_failed;
+        }
+
+        void WriteChunk(ReplayChunkType type, uint32_t firstTick, uint32_t lastTick, MemoryStream&& data)
+        {
+            // Jobs have to be copyable, the data is released as soon as the chunk is written.
+            auto chunkData = std::make_shared<MemoryStream>(std::move(data));
+            _jobs.AddTask([this, type, firstTick, lastTick, chunkData]() {
+                auto stream = std::move(*chunkData);
+                WriteChunkNow(type, firstTick, lastTick, stream);
+            });
+        }
+
+        /**
+         * Waits for all chunks to be written and closes the file, returns false if anything could not be written.
+         */
+        bool Close(bool writeIndex)
+        {
+            if (_fp == nullptr)
+                return false;
+
+            if (writeIndex)
+            {
+                _jobs.AddTask([this]() { WriteIndexNow(); });
+            }
+            _jobs.Join();
+
+            fclose(_fp);
+            _fp = nullptr;
+            return !_failed;
+        }
+
+    private:
+        void Write(const IStream& stream)
+        {
+            if (_failed)
+                return;
+
+            if (fwrite(stream.GetData(), 1, stream.GetLength(), _fp) != stream.GetLength() || fflush(_fp) != 0)
+            {
+                _failed = true;
+                return;
+            }
+            _offset += stream.GetLength();
+        }
+
+        void WriteChunkNow(ReplayChunkType type, uint32_t firstTick, uint32_t lastTick, const IStream& data)
+        {
+            unsigned long compressLength = compressBound(static_cast<unsigned long>(data.GetLength()));
+            auto compressBuf = std::make_unique<unsigned char[]>(compressLength);
+            compress2(
+                compressBuf.get(), &compressLength, static_cast<const unsigned char*>(data.GetData()), data.GetLength(),
+                ReplayCompressionLevel);
+
+            _index.push_back({ type, firstTick, lastTick, _offset });
+
+            DataSerialiser chunkSerialiser(true);
+            chunkSerialiser << EnumValue(type);
+            chunkSerialiser << firstTick;
+            chunkSerialiser << lastTick;
+            chunkSerialiser << static_cast<uint32_t>(data.GetLength());
+            chunkSerialiser << static_cast<uint32_t>(compressLength);
+            auto& stream = chunkSerialiser.GetStream();
+            stream.Write(compressBuf.get(), compressLength);
+            Write(stream);
+        }
+
+        void WriteIndexNow()
+        {
+            uint64_t indexOffset = _offset;
+
+            DataSerialiser indexSerialiser(true);
+            uint32_t numEntries = static_cast<uint32_t>(_index.size());
+            indexSerialiser << numEntries;
+            for (const auto& entry : _index)
+            {
+                indexSerialiser << EnumValue(entry.type);
+                indexSerialiser << entry.firstTick;
+                indexSerialiser << entry.lastTick;
+                indexSerialiser << entry.offset;
+            }
+            WriteChunkNow(ReplayChunkType::Index, 0, 0, indexSerialiser.GetStream());
+
+            DataSerialiser trailerSerialiser(true);
+            trailerSerialiser << indexOffset;
+            trailerSerialiser << ReplayIndexMagic;
+            Write(trailerSerialiser.GetStream());
+        }
     };
 
     class ReplayManager final : public IReplayManager
     {
-        static constexpr uint16_t ReplayVersion = 4;
+        static constexpr uint16_t ReplayVersion = 5;
+        // Last version that stored the whole recording as a single compressed block.
+        static constexpr uint16_t MonolithicReplayVersion = 4;
         static constexpr uint32_t ReplayMagic = 0x5243524F; // ORCR.
-        static constexpr int ReplayCompressionLevel = 9;
+        // Recorded commands and checksums are written out about once a minute.
+        static constexpr uint32_t ReplayChunkTicks = 40 * 60;
+        // A keyframe about every five minutes bounds how much has to be simulated when seeking.
+        static constexpr uint32_t ReplayKeyframeTicks = ReplayChunkTicks * 5;
         static constexpr int NormalRecordingChecksumTicks = 1;
         static constexpr int SilentRecordingChecksumTicks = 40; // Same as network server
 
@@ -166,6 +338,20 @@ namespace OpenRCT2
                 _nextChecksumTick = gCurrentTicks + ChecksumTicksDelta();
             }
 
+            if ((_mode == ReplayMode::RECORDING || _mode == ReplayMode::NORMALISATION) && _currentRecording != nullptr)
+            {
+                if (gCurrentTicks - _chunkStartTick >= ReplayChunkTicks)
+                {
+                    WriteRecordsChunk(gCurrentTicks - 1);
+                }
+                // Saving the park stalls the game, silent recordings are only kept for crashes and desyncs and are not
+                // seeked through.
+                if (_recordType != RecordType::SILENT && gCurrentTicks - _keyframeTick >= ReplayKeyframeTicks)
+                {
+                    WriteKeyframeChunk();
+                }
+            }
+
             if (_mode == ReplayMode::RECORDING)
             {
                 if (gCurrentTicks >= _currentRecording->tickEnd)
@@ -242,31 +428,43 @@ namespace OpenRCT2
 
             replayData->filePath = name;
 
-            auto context = GetContext();
-            auto& objManager = context->GetObjectManager();
-            auto objects = objManager.GetPackableObjects();
-
-            auto s6exporter = std::make_unique<S6Exporter>();
-            s6exporter->ExportObjectsList = objects;
-            s6exporter->Export();
-            s6exporter->SaveGame(&replayData->parkData);
+            SaveParkState(replayData->parkData, replayData->parkParams, replayData->cheatData);
 
             replayData->timeRecorded = std::chrono::seconds(std::time(nullptr)).count();
 
-            DataSerialiser parkParamsDs(true, replayData->parkParams);
-            SerialiseParkParameters(parkParamsDs);
+            TakeGameStateSnapshot(replayData->gameStateSnapshots);
 
-            DataSerialiser cheatDataDs(true, replayData->cheatData);
-            SerialiseCheats(cheatDataDs);
+            // A silent recording replaces the one of the previous session, which is kept until the new one is complete.
+            auto writePath = replayData->filePath;
+            if (rt == RecordType::SILENT)
+                writePath += ".tmp";
 
-            TakeGameStateSnapshot(replayData->gameStateSnapshots);
+            auto writer = std::make_unique<ReplayChunkWriter>();
+            if (!writer->Open(writePath, replayData->magic, replayData->version))
+            {
+                log_error("Unable to write to file '%s'", writePath.c_str());
+                return false;
+            }
+
+            // The park is only needed for the header, so hand it over to the writer instead of keeping it around.
+            MemoryStream headerStream;
+            DataSerialiser headerSerialiser(true, headerStream);
+            SerialiseHeader(headerSerialiser, *replayData);
+            writer->WriteChunk(
+                ReplayChunkType::Header, replayData->tickStart, replayData->tickStart, std::move(headerStream));
+            replayData->parkData = MemoryStream();
+            replayData->gameStateSnapshots = MemoryStream();
 
             if (_mode != ReplayMode::NORMALISATION)
                 _mode = ReplayMode::RECORDING;
 
             _currentRecording = std::move(replayData);
+            _recordingWriter = std::move(writer);
+            _recordingWritePath = std::move(writePath);
             _recordType = rt;
             _nextChecksumTick = gCurrentTicks + 1;
+            _chunkStartTick = gCurrentTicks;
+            _keyframeTick = gCurrentTicks;
 
             return true;
         }
@@ -276,8 +474,13 @@ namespace OpenRCT2
             if (_mode != ReplayMode::RECORDING && _mode != ReplayMode::NORMALISATION)
                 return false;
 
+            const std::string& outFile = _currentRecording->filePath;
+
             if (discard)
             {
+                _recordingWriter->Close(false);
+                _recordingWriter.reset();
+                File::Delete(_recordingWritePath);
                 _currentRecording.reset();
                 _mode = ReplayMode::NONE;
                 return true;
@@ -289,50 +492,33 @@ namespace OpenRCT2
                 rct_sprite_checksum checksum = sprite_checksum();
                 AddChecksum(gCurrentTicks, std::move(checksum));
             }
-
-            TakeGameStateSnapshot(_currentRecording->gameStateSnapshots);
-
-            // Serialise Body.
-            DataSerialiser recSerialiser(true);
-            Serialise(recSerialiser, *_currentRecording);
-
-            const auto& stream = recSerialiser.GetStream();
-            unsigned long streamLength = static_cast<unsigned long>(stream.GetLength());
-            unsigned long compressLength = compressBound(streamLength);
-
-            MemoryStream data(compressLength);
-
-            ReplayRecordFile file{ _currentRecording->magic, _currentRecording->version, streamLength, data };
-
-            auto compressBuf = std::make_unique<unsigned char[]>(compressLength);
-            compress2(
-                compressBuf.get(), &compressLength, static_cast<const unsigned char*>(stream.GetData()), stream.GetLength(),
-                ReplayCompressionLevel);
-            file.data.Write(compressBuf.get(), compressLength);
-
-            DataSerialiser fileSerialiser(true);
-            fileSerialiser << file.magic;
-            fileSerialiser << file.version;
-            fileSerialiser << file.uncompressedSize;
-            fileSerialiser << file.data;
-
-            bool result = false;
-
-            const std::string& outFile = _currentRecording->filePath;
-
-            FILE* fp = fopen(outFile.c_str(), "wb");
-            if (fp)
+            WriteRecordsChunk(gCurrentTicks);
+
+            MemoryStream endStream;
+            DataSerialiser endSerialiser(true, endStream);
+            endSerialiser << _currentRecording->tickEnd;
+            MemoryStream snapshotStream;
+            TakeGameStateSnapshot(snapshotStream);
+            endSerialiser << snapshotStream;
+            _recordingWriter->WriteChunk(
+                ReplayChunkType::End, _currentRecording->tickEnd, _currentRecording->tickEnd, std::move(endStream));
+
+            // Only the end of the recording is left to compress, so this does not wait long.
+            bool result = _recordingWriter->Close(true);
+            _recordingWriter.reset();
+            if (!result)
             {
-                const auto& fileStream = fileSerialiser.GetStream();
-                fwrite(fileStream.GetData(), 1, fileStream.GetLength(), fp);
-                fclose(fp);
-
-                result = true;
+                log_error("Unable to write to file '%s'", _recordingWritePath.c_str());
             }
-            else
+            else if (_recordingWritePath != outFile)
             {
-                log_error("Unable to write to file '%s'", outFile.c_str());
-                result = false;
+                if (File::Exists(outFile))
+                    File::Delete(outFile);
+                result = File::Move(_recordingWritePath, outFile);
+                if (!result)
+                {
+                    log_error("Unable to move '%s' to '%s'", _recordingWritePath.c_str(), outFile.c_str());
+                }
             }
 
             // When normalizing the output we don't touch the mode.
@@ -369,8 +555,8 @@ namespace OpenRCT2
                 info.Ticks = gCurrentTicks - data->tickStart;
             else if (_mode == ReplayMode::PLAYING)
                 info.Ticks = data->tickEnd - data->tickStart;
-            info.NumCommands = static_cast<uint32_t>(data->commands.size());
-            info.NumChecksums = static_cast<uint32_t>(data->checksums.size());
+            info.NumCommands = data->numCommandsWritten + static_cast<uint32_t>(data->commands.size());
+            info.NumChecksums = data->numChecksumsWritten + static_cast<uint32_t>(data->checksums.size());
 
             return true;
         }
@@ -419,34 +605,43 @@ namespace OpenRCT2
             if (_mode != ReplayMode::NONE && _mode != ReplayMode::NORMALISATION)
                 return false;
 
-            auto replayData = std::make_unique<ReplayRecordData>();
+            if (!LoadPlayback(file, 0))
+                return false;
+
+            if (_mode != ReplayMode::NORMALISATION)
+                _mode = ReplayMode::PLAYING;
+
+            return true;
+        }
+
+        virtual bool Seek(uint32_t tick) override
+        {
+            if (_mode != ReplayMode::PLAYING)
+                return false;
 
-            if (!ReadReplayData(file, *replayData))
+            uint32_t numTicks = _currentReplay->tickEnd - _currentReplay->tickStart;
+            if (tick > numTicks)
             {
-                log_error("Unable to read replay data.");
+                log_error("Unable to seek to tick %u, the replay only has %u ticks.", tick, numTicks);
                 return false;
             }
 
-            if (!LoadReplayDataMap(*replayData))
+            // The file is read again as the commands before the current tick have already been replayed.
+            uint32_t targetTick = _currentReplay->tickStart + tick;
+            std::string file = _currentReplay->filePath;
+            if (!LoadPlayback(file, tick))
             {
-                log_error("Unable to load map.");
+                _currentReplay.reset();
+                _mode = ReplayMode::NONE;
                 return false;
             }
 
-            gCurrentTicks = replayData->tickStart;
-
-            LoadAndCompareSnapshot(replayData->gameStateSnapshots);
-
-            _currentReplay = std::move(replayData);
-            _currentReplay->checksumIndex = 0;
-            _faultyChecksumIndex = -1;
-
-            // Make sure game is not paused.
-            gGamePaused = 0;
-
-            if (_mode != ReplayMode::NORMALISATION)
-                _mode = ReplayMode::PLAYING;
-
+            // Update replays the commands and checks the state as usual while simulating up to the tick.
+            auto* gameState = GetContext()->GetGameState();
+            while (IsReplaying() && gCurrentTicks < targetTick)
+            {
+                gameState->UpdateLogic();
+            }
             return true;
         }
 
@@ -460,7 +655,12 @@ namespace OpenRCT2
             if (_mode != ReplayMode::PLAYING && _mode != ReplayMode::NORMALISATION)
                 return false;
 
-            LoadAndCompareSnapshot(_currentReplay->gameStateSnapshots);
+            // A recording that was cut short has no final snapshot to compare against.
+            auto& snapshotStream = _currentReplay->gameStateSnapshots;
+            if (snapshotStream.GetPosition() < snapshotStream.GetLength())
+            {
+                LoadAndCompareSnapshot(snapshotStream);
+            }
 
             // During normal playback we pause the game if stopped.
             if (_mode == ReplayMode::PLAYING)
@@ -513,6 +713,105 @@ namespace OpenRCT2
             }
         }
 
+        /**
+         * Saves everything needed to load the park as it is now, for the header and every keyframe.
+         */
+        void SaveParkState(MemoryStream& parkData, MemoryStream& parkParams, MemoryStream& cheatData)
+        {
+            auto context = GetContext();
+            auto& objManager = context->GetObjectManager();
+            auto objects = objManager.GetPackableObjects();
+
+            auto s6exporter = std::make_unique<S6Exporter>();
+            s6exporter->ExportObjectsList = objects;
+            s6exporter->Export();
+            s6exporter->SaveGame(&parkData);
+
+            DataSerialiser parkParamsDs(true, parkParams);
+            SerialiseParkParameters(parkParamsDs);
+
+            DataSerialiser cheatDataDs(true, cheatData);
+            SerialiseCheats(cheatDataDs);
+        }
+
+        /**
+         * Hands the whole park over to the writer so playback can seek to the current tick.
+         */
+        void WriteKeyframeChunk()
+        {
+            MemoryStream parkData;
+            MemoryStream parkParams;
+            MemoryStream cheatData;
+            SaveParkState(parkData, parkParams, cheatData);
+
+            MemoryStream keyframeStream;
+            DataSerialiser keyframeSerialiser(true, keyframeStream);
+            keyframeSerialiser << parkData;
+            keyframeSerialiser << parkParams;
+            keyframeSerialiser << cheatData;
+            // Actions of this tick may already have run, so the ones in the park are told apart by their index.
+            keyframeSerialiser << _commandId;
+            _recordingWriter->WriteChunk(ReplayChunkType::Keyframe, gCurrentTicks, gCurrentTicks, std::move(keyframeStream));
+            _keyframeTick = gCurrentTicks;
+        }
+
+        /**
+         * Hands the commands and checksums recorded so far over to the writer.
+         */
+        void WriteRecordsChunk(uint32_t lastTick)
+        {
+            auto& recording = *_currentRecording;
+
+            MemoryStream recordsStream;
+            DataSerialiser recordsSerialiser(true, recordsStream);
+            SerialiseRecords(recordsSerialiser, recording);
+            _recordingWriter->WriteChunk(ReplayChunkType::Records, _chunkStartTick, lastTick, std::move(recordsStream));
+
+            recording.numCommandsWritten += static_cast<uint32_t>(recording.commands.size());
+            recording.numChecksumsWritten += static_cast<uint32_t>(recording.checksums.size());
+            recording.commands.clear();
+            recording.checksums.clear();
+            _chunkStartTick = lastTick + 1;
+        }
+
+        /**
+         * Reads a replay and loads its park, ready to be played from the last keyframe at or before seekTick, counted from
+         * the start of the replay. Without a keyframe it is played from the start.
+         */
+        bool LoadPlayback(const std::string& file, uint32_t seekTick)
+        {
+            auto replayData = std::make_unique<ReplayRecordData>();
+
+            if (!ReadReplayData(file, *replayData, seekTick))
+            {
+                log_error("Unable to read replay data.");
+                return false;
+            }
+
+            if (!LoadReplayDataMap(*replayData))
+            {
+                log_error("Unable to load map.");
+                return false;
+            }
+
+            gCurrentTicks = replayData->parkTick;
+
+            // Keyframes have no snapshot, only the start of the recording can be compared.
+            if (replayData->parkTick == replayData->tickStart)
+            {
+                LoadAndCompareSnapshot(replayData->gameStateSnapshots);
+            }
+
+            _currentReplay = std::move(replayData);
+            _currentReplay->checksumIndex = 0;
+            _faultyChecksumIndex = -1;
+
+            // Make sure game is not paused.
+            gGamePaused = 0;
+
+            return true;
+        }
+
         bool LoadReplayDataMap(ReplayRecordData& data)
         {
             try
@@ -551,23 +850,19 @@ namespace OpenRCT2
             return true;
         }
 
-        bool ReadReplayFromFile(const std::string& file, MemoryStream& stream)
+        std::unique_ptr<FileStream> OpenReplayFile(const std::string& file)
         {
-            FILE* fp = fopen(file.c_str(), "rb");
-            if (!fp)
-                return false;
+            if (!File::Exists(file))
+                return nullptr;
 
-            char buffer[128];
-            while (feof(fp) == 0)
+            try
             {
-                size_t numBytesRead = fread(buffer, 1, 128, fp);
-                if (numBytesRead == 0)
-                    break;
-                stream.Write(buffer, numBytesRead);
+                return std::make_unique<FileStream>(file, FILE_MODE_OPEN);
+            }
+            catch (const IOException&)
+            {
+                return nullptr;
             }
-
-            fclose(fp);
-            return true;
         }
 
         /**
@@ -604,10 +899,8 @@ namespace OpenRCT2
             return true;
         }
 
-        bool ReadReplayData(const std::string& file, ReplayRecordData& data)
+        bool ReadReplayData(const std::string& file, ReplayRecordData& data, uint32_t seekTick)
         {
-            MemoryStream stream;
-
             std::string fileName = file;
             if (fileName.size() < 5 || fileName.substr(fileName.size() - 5) != ".sv6r")
             {
@@ -617,20 +910,46 @@ namespace OpenRCT2
             std::string outPath = GetContext()->GetPlatformEnvironment()->GetDirectoryPath(DIRBASE::USER, DIRID::REPLAY);
             std::string outFile = Path::Combine(outPath, fileName);
 
-            bool loaded = false;
-            if (ReadReplayFromFile(outFile, stream))
+            auto fileStream = OpenReplayFile(outFile);
+            if (fileStream != nullptr)
             {
                 data.filePath = outFile;
-                loaded = true;
             }
-            else if (ReadReplayFromFile(file, stream))
+            else
             {
+                fileStream = OpenReplayFile(file);
+                if (fileStream == nullptr)
+                    return false;
                 data.filePath = file;
-                loaded = true;
             }
-            if (!loaded)
+            if (fileStream->GetLength() < ReplayFileHeaderSize)
                 return false;
 
+            uint32_t magic = 0;
+            DataSerialiser fileSerialiser(false, *fileStream);
+            fileSerialiser << magic;
+            fileSerialiser << data.version;
+            if (data.version > MonolithicReplayVersion)
+            {
+                // Chunks are read from the file as they are needed, large keyframes that are not used are never read.
+                data.magic = magic;
+                if (!ReadReplayChunks(*fileStream, data, seekTick))
+                    return false;
+
+                data.parkData.SetPosition(0);
+                data.parkParams.SetPosition(0);
+                data.cheatData.SetPosition(0);
+                data.gameStateSnapshots.SetPosition(0);
+                return true;
+            }
+
+            // Older recordings are a single compressed block.
+            MemoryStream stream;
+            auto fileLength = fileStream->GetLength();
+            auto fileData = std::make_unique<uint8_t[]>(fileLength);
+            fileStream->SetPosition(0);
+            fileStream->Read(fileData.get(), fileLength);
+            stream.Write(fileData.get(), fileLength);
             if (!TryDecompress(stream))
                 return false;
 
@@ -640,6 +959,7 @@ namespace OpenRCT2
             {
                 return false;
             }
+            data.parkTick = data.tickStart;
 
             // Reset position of all streams.
             data.parkData.SetPosition(0);
@@ -650,6 +970,353 @@ namespace OpenRCT2
             return true;
         }
 
+        /**
+         * Reads every complete chunk of a streamed recording. A recording that was cut short ends after its last complete
+         * chunk and is played up to the last tick recorded in it. The park is taken from the last keyframe at or before
+         * seekTick, dropping everything recorded before it.
+         */
+        bool ReadReplayChunks(IStream& file, ReplayRecordData& data, uint32_t seekTick)
+        {
+            if (data.magic != ReplayMagic || data.version != ReplayVersion)
+            {
+                log_error(
+                    "Invalid replay %08X version %04X, expected: %08X %04X", data.magic, data.version, ReplayMagic,
+                    ReplayVersion);
+                return false;
+            }
+
+            std::vector<ReplayChunkIndexEntry> chunks;
+            if (!ReadChunkIndex(file, chunks))
+            {
+                // Recordings that were cut short have no index.
+                ScanChunks(file, chunks);
+            }
+
+            bool hasHeader = false;
+            bool hasEnd = false;
+            uint32_t lastTick = 0;
+            MemoryStream endSnapshot;
+
+            // Keyframes are large, so only the one that is used gets read.
+            const ReplayChunkIndexEntry* keyframe = nullptr;
+
+            for (const auto& chunk : chunks)
+            {
+                if (!hasHeader && chunk.type != ReplayChunkType::Header)
+                    break;
+
+                if (chunk.type == ReplayChunkType::Keyframe)
+                {
+                    if (chunk.firstTick - data.tickStart <= seekTick)
+                    {
+                        keyframe = &chunk;
+                    }
+                    continue;
+                }
+
+                ReplayChunkHeader chunkHeader;
+                auto buffer = ReadChunk(file, chunk.offset, chunkHeader);
+                if (buffer == nullptr)
+                    break;
+
+                try
+                {
+                    MemoryStream chunkStream(buffer.get(), chunkHeader.uncompressedSize);
+                    DataSerialiser chunkSerialiser(false, chunkStream);
+                    switch (chunk.type)
+                    {
+                        case ReplayChunkType::Header:
+                            SerialiseHeader(chunkSerialiser, data);
+                            hasHeader = true;
+                            lastTick = data.tickStart;
+                            break;
+                        case ReplayChunkType::Records:
+                            SerialiseRecords(chunkSerialiser, data);
+                            lastTick = std::max(lastTick, chunk.lastTick);
+                            break;
+                        case ReplayChunkType::End:
+                            chunkSerialiser << data.tickEnd;
+                            chunkSerialiser << endSnapshot;
+                            hasEnd = true;
+                            break;
+                        default:
+                            break;
+                    }
+                }
+                catch (const std::exception& e)
+                {
+                    log_warning("Unable to read replay chunk: %s", e.what());
+                    break;
+                }
+            }
+
+            if (!hasHeader)
+            {
+                log_error("Replay has no header.");
+                return false;
+            }
+            if (!hasEnd)
+            {
+                log_warning("Replay was not stopped properly, it can only be played up to tick %u.", lastTick);
+                data.tickEnd = lastTick;
+            }
+
+            data.parkTick = data.tickStart;
+            if (keyframe != nullptr)
+            {
+                uint32_t keyframeTick = keyframe->firstTick;
+                uint32_t firstCommandIndex = 0;
+                if (!ReadKeyframe(file, keyframe->offset, data, firstCommandIndex))
+                {
+                    log_error("Unable to read replay keyframe at tick %u.", keyframeTick);
+                    return false;
+                }
+                data.parkTick = keyframeTick;
+
+                // Whatever happened before the keyframe is already part of its park, including the actions of its tick
+                // that ran before it was saved. The snapshot of the header does not match the keyframe either.
+                for (auto it = data.commands.begin(); it != data.commands.end();)
+                {
+                    if (it->commandIndex < firstCommandIndex)
+                        it = data.commands.erase(it);
+                    else
+                        it++;
+                }
+                data.gameStateSnapshots = MemoryStream();
+                auto firstChecksum = std::find_if(
+                    data.checksums.begin(), data.checksums.end(),
+                    [keyframeTick](const auto& checksum) { return checksum.first >= keyframeTick; });
+                data.checksums.erase(data.checksums.begin(), firstChecksum);
+            }
+
+            if (hasEnd)
+            {
+                data.gameStateSnapshots.SetPosition(data.gameStateSnapshots.GetLength());
+                data.gameStateSnapshots.Write(endSnapshot.GetData(), endSnapshot.GetLength());
+            }
+            return true;
+        }
+
+        /**
+         * Reads the index a recording that was stopped properly ends with, returns false if there is none or it is
+         * corrupt.
+         */
+        bool ReadChunkIndex(IStream& file, std::vector<ReplayChunkIndexEntry>& chunks)
+        {
+            const uint64_t fileLength = file.GetLength();
+            if (fileLength < ReplayFileHeaderSize + ReplayChunkHeaderSize + ReplayTrailerSize)
+                return false;
+
+            uint64_t indexOffset = 0;
+            uint32_t indexMagic = 0;
+            file.SetPosition(fileLength - ReplayTrailerSize);
+            DataSerialiser trailerSerialiser(false, file);
+            trailerSerialiser << indexOffset;
+            trailerSerialiser << indexMagic;
+            if (indexMagic != ReplayIndexMagic || indexOffset < ReplayFileHeaderSize
+                || indexOffset >= fileLength - ReplayTrailerSize)
+            {
+                return false;
+            }
+
+            ReplayChunkHeader indexHeader;
+            auto buffer = ReadChunk(file, indexOffset, indexHeader);
+            if (buffer == nullptr || indexHeader.type != ReplayChunkType::Index)
+                return false;
+
+            try
+            {
+                MemoryStream indexStream(buffer.get(), indexHeader.uncompressedSize);
+                DataSerialiser indexSerialiser(false, indexStream);
+                uint32_t numEntries = 0;
+                indexSerialiser << numEntries;
+                for (uint32_t i = 0; i < numEntries; i++)
+                {
+                    uint8_t type = 0;
+                    ReplayChunkIndexEntry entry{};
+                    indexSerialiser << type;
+                    indexSerialiser << entry.firstTick;
+                    indexSerialiser << entry.lastTick;
+                    indexSerialiser << entry.offset;
+                    if (entry.offset < ReplayFileHeaderSize || entry.offset >= indexOffset)
+                    {
+                        chunks.clear();
+                        return false;
+                    }
+                    entry.type = static_cast<ReplayChunkType>(type);
+                    chunks.push_back(entry);
+                }
+            }
+            catch (const std::exception& e)
+            {
+                log_warning("Unable to read replay index: %s", e.what());
+                chunks.clear();
+                return false;
+            }
+            return true;
+        }
+
+        /**
+         * Walks the chunk headers from the start of the file up to the last complete chunk.
+         */
+        void ScanChunks(IStream& file, std::vector<ReplayChunkIndexEntry>& chunks)
+        {
+            const uint64_t fileLength = file.GetLength();
+            uint64_t offset = ReplayFileHeaderSize;
+            while (fileLength - offset >= ReplayChunkHeaderSize)
+            {
+                ReplayChunkHeader chunkHeader;
+                file.SetPosition(offset);
+                ReadChunkHeader(file, chunkHeader);
+                if (fileLength - file.GetPosition() < chunkHeader.compressedSize)
+                    break;
+                if (chunkHeader.type == ReplayChunkType::Index)
+                    break;
+
+                chunks.push_back({ chunkHeader.type, chunkHeader.firstTick, chunkHeader.lastTick, offset });
+                offset = file.GetPosition() + chunkHeader.compressedSize;
+            }
+        }
+
+        void ReadChunkHeader(IStream& file, ReplayChunkHeader& chunkHeader)
+        {
+            uint8_t type = 0;
+            DataSerialiser chunkSerialiser(false, file);
+            chunkSerialiser << type;
+            chunkSerialiser << chunkHeader.firstTick;
+            chunkSerialiser << chunkHeader.lastTick;
+            chunkSerialiser << chunkHeader.uncompressedSize;
+            chunkSerialiser << chunkHeader.compressedSize;
+            chunkHeader.type = static_cast<ReplayChunkType>(type);
+        }
+
+        /**
+         * Reads and decompresses the chunk at the given offset, returns nullptr if it is incomplete or corrupt.
+         */
+        std::unique_ptr<unsigned char[]> ReadChunk(IStream& file, uint64_t offset, ReplayChunkHeader& chunkHeader)
+        {
+            const uint64_t fileLength = file.GetLength();
+            if (offset > fileLength || fileLength - offset < ReplayChunkHeaderSize)
+                return nullptr;
+
+            try
+            {
+                file.SetPosition(offset);
+                ReadChunkHeader(file, chunkHeader);
+                if (fileLength - file.GetPosition() < chunkHeader.compressedSize)
+                    return nullptr;
+
+                auto compressedData = std::make_unique<unsigned char[]>(chunkHeader.compressedSize);
+                file.Read(compressedData.get(), chunkHeader.compressedSize);
+
+                auto buffer = std::make_unique<unsigned char[]>(chunkHeader.uncompressedSize);
+                unsigned long outSize = chunkHeader.uncompressedSize;
+                int zresult = uncompress(buffer.get(), &outSize, compressedData.get(), chunkHeader.compressedSize);
+                if (zresult != Z_OK || outSize != chunkHeader.uncompressedSize)
+                    return nullptr;
+                return buffer;
+            }
+            catch (const std::exception& e)
+            {
+                log_warning("Unable to read replay chunk: %s", e.what());
+                return nullptr;
+            }
+        }
+
+        bool ReadKeyframe(IStream& file, uint64_t offset, ReplayRecordData& data, uint32_t& firstCommandIndex)
+        {
+            ReplayChunkHeader chunkHeader;
+            auto buffer = ReadChunk(file, offset, chunkHeader);
+            if (buffer == nullptr || chunkHeader.type != ReplayChunkType::Keyframe)
+                return false;
+
+            try
+            {
+                MemoryStream keyframeStream(buffer.get(), chunkHeader.uncompressedSize);
+                DataSerialiser keyframeSerialiser(false, keyframeStream);
+                MemoryStream parkData;
+                MemoryStream parkParams;
+                MemoryStream cheatData;
+                keyframeSerialiser << parkData;
+                keyframeSerialiser << parkParams;
+                keyframeSerialiser << cheatData;
+                keyframeSerialiser << firstCommandIndex;
+                data.parkData = std::move(parkData);
+                data.parkParams = std::move(parkParams);
+                data.cheatData = std::move(cheatData);
+            }
+            catch (const std::exception& e)
+            {
+                log_warning("Unable to read replay keyframe: %s", e.what());
+                return false;
+            }
+            return true;
+        }
+
+        bool SerialiseHeader(DataSerialiser& serialiser, ReplayRecordData& data)
+        {
+            serialiser << data.networkId;
+#ifndef DISABLE_NETWORK
+            // NOTE: This does not mean the replay will not function, only a warning.
+            if (serialiser.IsLoading() && data.networkId != network_get_version())
+            {
+                log_warning(
+                    "Replay network version mismatch: '%s', expected: '%s'", data.networkId.c_str(),
+                    network_get_version().c_str());
+            }
+#endif
+
+            serialiser << data.name;
+            serialiser << data.timeRecorded;
+            serialiser << data.parkData;
+            serialiser << data.parkParams;
+            serialiser << data.cheatData;
+            serialiser << data.tickStart;
+            serialiser << data.gameStateSnapshots;
+            return true;
+        }
+
+        bool SerialiseRecords(DataSerialiser& serialiser, ReplayRecordData& data)
+        {
+            uint32_t countCommands = static_cast<uint32_t>(data.commands.size());
+            serialiser << countCommands;
+
+            if (serialiser.IsSaving())
+            {
+                for (auto& command : data.commands)
+                {
+                    SerialiseCommand(serialiser, const_cast<ReplayCommand&>(command));
+                }
+            }
+            else
+            {
+                for (uint32_t i = 0; i < countCommands; i++)
+                {
+                    ReplayCommand command = {};
+                    SerialiseCommand(serialiser, command);
+
+                    data.commands.emplace(std::move(command));
+                }
+            }
+
+            uint32_t countChecksums = static_cast<uint32_t>(data.checksums.size());
+            serialiser << countChecksums;
+
+            // Loading appends to the checksums read from earlier chunks.
+            size_t firstChecksum = serialiser.IsLoading() ? data.checksums.size() : 0;
+            if (serialiser.IsLoading())
+            {
+                data.checksums.resize(firstChecksum + countChecksums);
+            }
+
+            for (uint32_t i = 0; i < countChecksums; i++)
+            {
+                serialiser << data.checksums[firstChecksum + i].first;
+                serialiser << data.checksums[firstChecksum + i].second.raw;
+            }
+            return true;
+        }
+
         bool SerialiseCheats(DataSerialiser& serialiser)
         {
             CheatsSerialise(serialiser);
@@ -710,9 +1377,12 @@ namespace OpenRCT2
 
         bool Compatible(ReplayRecordData& data)
         {
-            return data.version == ReplayVersion;
+            return data.version == ReplayVersion || data.version == MonolithicReplayVersion;
         }
 
+        /**
+         * Recordings of MonolithicReplayVersion and earlier, the whole recording in one block.
+         */
         bool Serialise(DataSerialiser& serialiser, ReplayRecordData& data)
         {
             serialiser << data.magic;
@@ -747,40 +1417,7 @@ namespace OpenRCT2
             serialiser << data.tickStart;
             serialiser << data.tickEnd;
 
-            uint32_t countCommands = static_cast<uint32_t>(data.commands.size());
-            serialiser << countCommands;
-
-            if (serialiser.IsSaving())
-            {
-                for (auto& command : data.commands)
-                {
-                    SerialiseCommand(serialiser, const_cast<ReplayCommand&>(command));
-                }
-            }
-            else
-            {
-                for (uint32_t i = 0; i < countCommands; i++)
-                {
-                    ReplayCommand command = {};
-                    SerialiseCommand(serialiser, command);
-
-                    data.commands.emplace(std::move(command));
-                }
-            }
-
-            uint32_t countChecksums = static_cast<uint32_t>(data.checksums.size());
-            serialiser << countChecksums;
-
-            if (serialiser.IsLoading())
-            {
-                data.checksums.resize(countChecksums);
-            }
-
-            for (uint32_t i = 0; i < countChecksums; i++)
-            {
-                serialiser << data.checksums[i].first;
-                serialiser << data.checksums[i].second.raw;
-            }
+            SerialiseRecords(serialiser, data);
 
             serialiser << data.gameStateSnapshots;
             return true;
@@ -871,6 +1508,11 @@ namespace OpenRCT2
     private:
         ReplayMode _mode = ReplayMode::NONE;
         std::unique_ptr<ReplayRecordData> _currentRecording;
+        std::unique_ptr<ReplayChunkWriter> _recordingWriter;
+        // File the recording is written to until it is complete
+        std::string _recordingWritePath;
+        uint32_t _chunkStartTick = 0;
+        uint32_t _keyframeTick = 0;
         std::unique_ptr<ReplayRecordData> _currentReplay;
         int32_t _faultyChecksumIndex = -1;
         uint32_t _commandId = 0;
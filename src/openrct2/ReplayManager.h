@@ -62,6 +62,12 @@ namespace OpenRCT2
         virtual bool IsPlaybackStateMismatching() const = 0;
         virtual bool StopPlayback() = 0;
 
+        /**
+         * Moves playback to the given tick, counted from the start of the replay. The park is loaded from the closest
+         * keyframe before it and only the ticks after that keyframe are simulated.
+         */
+        virtual bool Seek(uint32_t tick) = 0;
+
         virtual bool NormaliseReplay(const std::string& inputFile, const std::string& outputFile) = 0;
     };
 
@@ -17,6 +17,8 @@
 #include "../world/LargeScenery.h"
 #include "../world/Location.hpp"
 #include "../world/Map.h"
+#include "../world/TileElementRegistry.h"
+#include "../world/TileElementsView.h"
 #include "FootpathRemoveAction.h"
 #include "LargeSceneryRemoveAction.h"
 #include "SmallSceneryRemoveAction.h"
@@ -209,21 +211,11 @@ money32 ClearAction::ClearSceneryFromTile(const CoordsXY& tilePos, bool executin
 
 void ClearAction::ResetClearLargeSceneryFlag()
 {
-    // TODO: Improve efficiency of this
-    for (int32_t y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL; y++)
+    for (const auto& tilePos : tile_element_registry_get(TileElementType::LargeScenery))
     {
-        for (int32_t x = 0; x < MAXIMUM_MAP_SIZE_TECHNICAL; x++)
+        for (auto* sceneryElement : TileElementsView<LargeSceneryElement>(tilePos.ToCoordsXY()))
         {
-            auto tileElement = map_get_first_element_at(TileCoordsXY{ x, y }.ToCoordsXY());
-            do
-            {
-                if (tileElement == nullptr)
-                    break;
-                if (tileElement->GetType() == TILE_ELEMENT_TYPE_LARGE_SCENERY)
-                {
-                    tileElement->AsLargeScenery()->SetIsAccounted(false);
-                }
-            } while (!(tileElement++)->IsLastForTile());
+            sceneryElement->SetIsAccounted(false);
         }
     }
 }
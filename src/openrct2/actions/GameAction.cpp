@@ -11,6 +11,7 @@
 
 #include "../Context.h"
 #include "../ReplayManager.h"
+#include "../config/Config.h"
 #include "../core/Guard.hpp"
 #include "../core/Memory.hpp"
 #include "../core/MemoryStream.h"
@@ -28,12 +29,82 @@
 #include "../world/Scenery.h"
 
 #include <algorithm>
+#include <deque>
 #include <iterator>
+#include <vector>
 
 using namespace OpenRCT2;
 
 namespace GameActions
 {
+    // Freed results are kept for reuse by size, results of all actions are a similar size
+    static constexpr size_t ResultPoolGranularity = 16;
+    static constexpr size_t ResultPoolMaxSize = 512;
+    static constexpr size_t ResultPoolMaxFree = 64;
+
+    struct ResultFreeList
+    {
+        std::array<void*, ResultPoolMaxFree> Entries;
+        size_t Count;
+    };
+
+    // Owns the cached blocks of one thread and gives them back when the thread exits
+    struct ResultPool
+    {
+        std::array<ResultFreeList, ResultPoolMaxSize / ResultPoolGranularity> FreeLists{};
+
+        ~ResultPool();
+    };
+    static thread_local ResultPool _resultPool;
+    // Results deleted by other thread_local destructors after the pool is gone bypass it
+    static thread_local bool _resultPoolDestroyed;
+
+    ResultPool::~ResultPool()
+    {
+        for (auto& freeList : FreeLists)
+        {
+            for (size_t i = 0; i < freeList.Count; i++)
+            {
+                ::operator delete(freeList.Entries[i]);
+            }
+            freeList.Count = 0;
+        }
+        _resultPoolDestroyed = true;
+    }
+
+    void* Result::operator new(size_t size)
+    {
+        if (size == 0 || size > ResultPoolMaxSize || _resultPoolDestroyed)
+        {
+            return ::operator new(size);
+        }
+
+        const auto sizeClass = (size - 1) / ResultPoolGranularity;
+        auto& freeList = _resultPool.FreeLists[sizeClass];
+        if (freeList.Count > 0)
+        {
+            return freeList.Entries[--freeList.Count];
+        }
+        return ::operator new((sizeClass + 1) * ResultPoolGranularity);
+    }
+
+    void Result::operator delete(void* ptr, size_t size)
+    {
+        if (ptr == nullptr)
+            return;
+
+        if (size != 0 && size <= ResultPoolMaxSize && !_resultPoolDestroyed)
+        {
+            auto& freeList = _resultPool.FreeLists[(size - 1) / ResultPoolGranularity];
+            if (freeList.Count < ResultPoolMaxFree)
+            {
+                freeList.Entries[freeList.Count++] = ptr;
+                return;
+            }
+        }
+        ::operator delete(ptr);
+    }
+
     Result::Result(GameActions::Status error, rct_string_id message)
     {
         Error = error;
@@ -95,22 +166,23 @@ namespace GameActions
             , action(std::move(ga))
         {
         }
+    };
 
-        bool operator<(const QueuedGameAction& comp) const
-        {
-            // First sort by tick
-            if (tick < comp.tick)
-                return true;
-            if (tick > comp.tick)
-                return false;
-
-            // If the ticks are equal sort by commandIndex
-            return uniqueId < comp.uniqueId;
-        }
+    // All actions queued for one tick in the order they were enqueued, which is the order of their unique ids
+    struct QueuedGameActionBucket
+    {
+        uint32_t tick;
+        size_t next;
+        std::vector<QueuedGameAction> actions;
     };
 
+    // Number of emptied buckets kept around so their storage can be reused
+    static constexpr size_t MaxSpareActionBuckets = 16;
+
     static GameActionFactory _actions[EnumValue(GameCommand::Count)];
-    static std::multiset<QueuedGameAction> _actionQueue;
+    // Buckets sorted by tick
+    static std::deque<QueuedGameActionBucket> _actionQueue;
+    static std::vector<std::vector<QueuedGameAction>> _spareActionBuckets;
     static uint32_t _nextUniqueId = 0;
     static bool _suspended = false;
 
@@ -158,7 +230,39 @@ namespace GameActions
             // as that normally happens when receiving them over network.
             ga->SetPlayer(network_get_current_player_id());
         }
-        _actionQueue.emplace(tick, std::move(ga), _nextUniqueId++);
+
+        // Actions are almost always queued for the latest tick
+        auto it = _actionQueue.end();
+        if (_actionQueue.empty() || _actionQueue.back().tick != tick)
+        {
+            it = std::lower_bound(
+                _actionQueue.begin(), _actionQueue.end(), tick,
+                [](const QueuedGameActionBucket& bucket, uint32_t t) { return bucket.tick < t; });
+            if (it == _actionQueue.end() || it->tick != tick)
+            {
+                QueuedGameActionBucket bucket{ tick, 0, {} };
+                if (!_spareActionBuckets.empty())
+                {
+                    bucket.actions = std::move(_spareActionBuckets.back());
+                    _spareActionBuckets.pop_back();
+                }
+                it = _actionQueue.insert(it, std::move(bucket));
+            }
+        }
+        else
+        {
+            it = std::prev(_actionQueue.end());
+        }
+        it->actions.emplace_back(tick, std::move(ga), _nextUniqueId++);
+    }
+
+    static void RecycleActionBucket(QueuedGameActionBucket& bucket)
+    {
+        if (_spareActionBuckets.size() < MaxSpareActionBuckets)
+        {
+            bucket.actions.clear();
+            _spareActionBuckets.push_back(std::move(bucket.actions));
+        }
     }
 
     void ProcessQueue()
@@ -171,16 +275,22 @@ namespace GameActions
 
         const uint32_t currentTick = gCurrentTicks;
 
-        while (_actionQueue.begin() != _actionQueue.end())
+        while (!_actionQueue.empty())
         {
-            // run all the game commands at the current tick
-            const QueuedGameAction& queued = *_actionQueue.begin();
+            auto& bucket = _actionQueue.front();
+            if (bucket.next >= bucket.actions.size())
+            {
+                RecycleActionBucket(bucket);
+                _actionQueue.pop_front();
+                continue;
+            }
 
             if (network_get_mode() == NETWORK_MODE_CLIENT)
             {
-                if (queued.tick < currentTick)
+                if (bucket.tick < currentTick)
                 {
                     // This should never happen.
+                    const QueuedGameAction& queued = bucket.actions[bucket.next];
                     Guard::Assert(
                         false,
                         "Discarding game action %s (%u) from tick behind current tick, ID: %08X, Action Tick: %08X, Current "
@@ -188,12 +298,16 @@ namespace GameActions
                         "%08X\n",
                         queued.action->GetName(), queued.action->GetType(), queued.uniqueId, queued.tick, currentTick);
                 }
-                else if (queued.tick > currentTick)
+                else if (bucket.tick > currentTick)
                 {
                     return;
                 }
             }
 
+            // Executing the action may queue further actions, which can move the bucket
+            auto queued = std::move(bucket.actions[bucket.next]);
+            bucket.next++;
+
             // Remove ghost scenery so it doesn't interfere with incoming network command
             switch (queued.action->GetType())
             {
@@ -218,16 +332,28 @@ namespace GameActions
                 // Relay this action to all other clients.
                 network_send_game_action(action);
             }
-
-            _actionQueue.erase(_actionQueue.begin());
         }
     }
 
     void ClearQueue()
     {
+        for (auto& bucket : _actionQueue)
+        {
+            RecycleActionBucket(bucket);
+        }
         _actionQueue.clear();
     }
 
+    size_t GetQueueSize()
+    {
+        size_t count = 0;
+        for (const auto& bucket : _actionQueue)
+        {
+            count += bucket.actions.size() - bucket.next;
+        }
+        return count;
+    }
+
     void Initialize()
     {
         static bool initialized = false;
@@ -343,10 +469,23 @@ namespace GameActions
     struct ActionLogContext_t
     {
         MemoryStream output;
+        bool enabled{};
     };
 
+    static bool IsActionLogEnabled()
+    {
+        return _log_levels[EnumValue(DiagnosticLevel::Verbose)]
+            || (network_get_mode() == NETWORK_MODE_SERVER && gConfigNetwork.log_server_actions);
+    }
+
     static void LogActionBegin(ActionLogContext_t& ctx, const GameAction* action)
     {
+        // Writing out the parameters is costly and area actions run thousands of nested actions, skip it when nothing
+        // would see the text
+        ctx.enabled = IsActionLogEnabled();
+        if (!ctx.enabled)
+            return;
+
         MemoryStream& output = ctx.output;
 
         char temp[128] = {};
@@ -364,6 +503,9 @@ namespace GameActions
 
     static void LogActionFinish(ActionLogContext_t& ctx, const GameAction* action, const GameActions::Result::Ptr& result)
     {
+        if (!ctx.enabled)
+            return;
+
         MemoryStream& output = ctx.output;
 
         char temp[128] = {};
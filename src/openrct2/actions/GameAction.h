@@ -138,6 +138,10 @@ namespace GameActions
         Result(const GameActions::Result&) = delete;
         virtual ~Result(){};
 
+        // Results are allocated from a pool as nested actions create thousands of them for a single area action
+        static void* operator new(size_t size);
+        static void operator delete(void* ptr, size_t size);
+
         std::string GetErrorTitle() const;
         std::string GetErrorMessage() const;
     };
@@ -399,6 +403,8 @@ namespace GameActions
     void Enqueue(GameAction::Ptr&& ga, uint32_t tick);
     void ProcessQueue();
     void ClearQueue();
+    // Number of queued actions that have not been processed yet
+    size_t GetQueueSize();
 
     GameAction::Ptr Create(GameCommand id);
     GameAction::Ptr Clone(const GameAction* action);
@@ -10,6 +10,7 @@
 
 #include "../management/Finance.h"
 #include "../ride/RideData.h"
+#include "../ride/RideTileIndex.h"
 #include "../ride/TrackData.h"
 
 MazePlaceTrackAction::MazePlaceTrackAction(const CoordsXYZ& location, NetworkRideId_t rideIndex, uint16_t mazeEntry)
@@ -176,6 +177,7 @@ GameActions::Result::Ptr MazePlaceTrackAction::Execute() const
     trackElement->SetRideIndex(_rideIndex);
     trackElement->SetMazeEntry(_mazeEntry);
     trackElement->SetGhost(flags & GAME_COMMAND_FLAG_GHOST);
+    ride_tile_index_add_element(_loc, trackElement->as<TileElement>());
 
     map_invalidate_tile_full(startLoc);
 
@@ -16,6 +16,7 @@
 #include "../localisation/StringIds.h"
 #include "../management/Finance.h"
 #include "../ride/RideData.h"
+#include "../ride/RideTileIndex.h"
 #include "../ride/Track.h"
 #include "../ride/TrackData.h"
 #include "../world/Footpath.h"
@@ -189,6 +190,7 @@ GameActions::Result::Ptr MazeSetTrackAction::Execute() const
         trackElement->SetRideIndex(_rideIndex);
         trackElement->SetMazeEntry(0xFFFF);
         trackElement->SetGhost(flags & GAME_COMMAND_FLAG_GHOST);
+        ride_tile_index_add_element(_loc, trackElement->as<TileElement>());
 
         tileElement = trackElement->as<TileElement>();
 
@@ -19,6 +19,7 @@
 #include "../management/NewsItem.h"
 #include "../ride/Ride.h"
 #include "../ride/RideData.h"
+#include "../ride/RideTileIndex.h"
 #include "../ui/UiContext.h"
 #include "../ui/WindowManager.h"
 #include "../world/Banner.h"
@@ -130,6 +131,7 @@ GameActions::Result::Ptr RideDemolishAction::DemolishRide(Ride* ride) const
 
     sub_6CB945(ride);
     ride_clear_leftover_entrances(ride);
+    ride_tile_index_clear(ride->id);
     News::DisableNewsItems(News::ItemType::Ride, _rideIndex);
 
     for (BannerIndex i = 0; i < MAX_BANNERS; i++)
@@ -286,58 +288,64 @@ money32 RideDemolishAction::DemolishTracks() const
     uint8_t oldpaused = gGamePaused;
     gGamePaused = 0;
 
-    tile_element_iterator it;
-
-    tile_element_iterator_begin(&it);
-    while (tile_element_iterator_next(&it))
+    // Copy the tiles as the index is not to be modified while iterating
+    const auto rideTiles = ride_tile_index_get(static_cast<ride_id_t>(_rideIndex));
+    for (const auto& tilePos : rideTiles)
     {
-        if (it.element->GetType() != TILE_ELEMENT_TYPE_TRACK)
-            continue;
+        auto* tileElement = map_get_first_element_at(tilePos.ToCoordsXY());
+        while (tileElement != nullptr)
+        {
+            if (tileElement->GetType() != TILE_ELEMENT_TYPE_TRACK
+                || tileElement->AsTrack()->GetRideIndex() != static_cast<ride_id_t>(_rideIndex))
+            {
+                if ((tileElement++)->IsLastForTile())
+                    break;
+                continue;
+            }
 
-        if (it.element->AsTrack()->GetRideIndex() != static_cast<ride_id_t>(_rideIndex))
-            continue;
+            auto location = CoordsXYZD(tilePos.ToCoordsXY(), tileElement->GetBaseZ(), tileElement->GetDirection());
+            auto type = tileElement->AsTrack()->GetTrackType();
 
-        auto location = CoordsXYZD(TileCoordsXY(it.x, it.y).ToCoordsXY(), it.element->GetBaseZ(), it.element->GetDirection());
-        auto type = it.element->AsTrack()->GetTrackType();
+            if (type != TrackElemType::Maze)
+            {
+                auto trackRemoveAction = TrackRemoveAction(type, tileElement->AsTrack()->GetSequenceIndex(), location);
+                trackRemoveAction.SetFlags(GAME_COMMAND_FLAG_NO_SPEND);
 
-        if (type != TrackElemType::Maze)
-        {
-            auto trackRemoveAction = TrackRemoveAction(type, it.element->AsTrack()->GetSequenceIndex(), location);
-            trackRemoveAction.SetFlags(GAME_COMMAND_FLAG_NO_SPEND);
+                auto removRes = GameActions::ExecuteNested(&trackRemoveAction);
 
-            auto removRes = GameActions::ExecuteNested(&trackRemoveAction);
+                if (removRes->Error != GameActions::Status::Ok)
+                {
+                    tile_element_remove(tileElement);
+                }
+                else
+                {
+                    refundPrice += removRes->Cost;
+                }
 
-            if (removRes->Error != GameActions::Status::Ok)
-            {
-                tile_element_remove(it.element);
-            }
-            else
-            {
-                refundPrice += removRes->Cost;
+                // Elements on this tile have moved, start again from the first one
+                tileElement = map_get_first_element_at(tilePos.ToCoordsXY());
+                continue;
             }
 
-            tile_element_iterator_restart_for_tile(&it);
-            continue;
-        }
+            static constexpr const CoordsXY DirOffsets[] = {
+                { 0, 0 },
+                { 0, 16 },
+                { 16, 16 },
+                { 16, 0 },
+            };
 
-        static constexpr const CoordsXY DirOffsets[] = {
-            { 0, 0 },
-            { 0, 16 },
-            { 16, 16 },
-            { 16, 0 },
-        };
+            for (Direction dir : ALL_DIRECTIONS)
+            {
+                const CoordsXYZ off = { DirOffsets[dir], 0 };
+                money32 removePrice = MazeRemoveTrack({ location + off, dir });
+                if (removePrice != MONEY32_UNDEFINED)
+                    refundPrice += removePrice;
+                else
+                    break;
+            }
 
-        for (Direction dir : ALL_DIRECTIONS)
-        {
-            const CoordsXYZ off = { DirOffsets[dir], 0 };
-            money32 removePrice = MazeRemoveTrack({ location + off, dir });
-            if (removePrice != MONEY32_UNDEFINED)
-                refundPrice += removePrice;
-            else
-                break;
+            tileElement = map_get_first_element_at(tilePos.ToCoordsXY());
         }
-
-        tile_element_iterator_restart_for_tile(&it);
     }
 
     gGamePaused = oldpaused;
@@ -12,6 +12,7 @@
 #include "../actions/RideEntranceExitRemoveAction.h"
 #include "../management/Finance.h"
 #include "../ride/Ride.h"
+#include "../ride/RideTileIndex.h"
 #include "../ride/Station.h"
 #include "../world/MapAnimation.h"
 
@@ -184,6 +185,7 @@ GameActions::Result::Ptr RideEntranceExitPlaceAction::Execute() const
     entranceElement->SetStationIndex(_stationNum);
     entranceElement->SetRideIndex(_rideIndex);
     entranceElement->SetGhost(GetFlags() & GAME_COMMAND_FLAG_GHOST);
+    ride_tile_index_add_element(_loc, entranceElement->as<TileElement>());
 
     if (_isExit)
     {
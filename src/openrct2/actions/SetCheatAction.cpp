@@ -34,9 +34,13 @@
 #include "../world/Scenery.h"
 #include "../world/Sprite.h"
 #include "../world/Surface.h"
+#include "../world/TileElementRegistry.h"
+#include "../world/TileElementsView.h"
 #include "ParkSetLoanAction.h"
 #include "ParkSetParameterAction.h"
 
+using namespace OpenRCT2;
+
 using ParametersRange = std::pair<std::pair<int32_t, int32_t>, std::pair<int32_t, int32_t>>;
 
 SetCheatAction::SetCheatAction(CheatType cheatType, int32_t param1, int32_t param2)
@@ -377,35 +381,29 @@ void SetCheatAction::SetGrassLength(int32_t length) const
 
 void SetCheatAction::WaterPlants() const
 {
-    tile_element_iterator it;
-
-    tile_element_iterator_begin(&it);
-    do
+    for (const auto& tilePos : tile_element_registry_get(TileElementType::SmallScenery))
     {
-        if (it.element->GetType() == TILE_ELEMENT_TYPE_SMALL_SCENERY)
+        for (auto* sceneryElement : TileElementsView<SmallSceneryElement>(tilePos.ToCoordsXY()))
         {
-            it.element->AsSmallScenery()->SetAge(0);
+            sceneryElement->SetAge(0);
         }
-    } while (tile_element_iterator_next(&it));
+    }
 
     gfx_invalidate_screen();
 }
 
 void SetCheatAction::FixVandalism() const
 {
-    tile_element_iterator it;
-
-    tile_element_iterator_begin(&it);
-    do
+    for (const auto& tilePos : tile_element_registry_get(TileElementType::Path))
     {
-        if (it.element->GetType() != TILE_ELEMENT_TYPE_PATH)
-            continue;
-
-        if (!(it.element)->AsPath()->HasAddition())
-            continue;
+        for (auto* pathElement : TileElementsView<PathElement>(tilePos.ToCoordsXY()))
+        {
+            if (!pathElement->HasAddition())
+                continue;
 
-        it.element->AsPath()->SetIsBroken(false);
-    } while (tile_element_iterator_next(&it));
+            pathElement->SetIsBroken(false);
+        }
+    }
 
     gfx_invalidate_screen();
 }
@@ -417,22 +415,18 @@ void SetCheatAction::RemoveLitter() const
         sprite_remove(litter);
     }
 
-    tile_element_iterator it;
-
-    tile_element_iterator_begin(&it);
-    do
+    for (const auto& tilePos : tile_element_registry_get(TileElementType::Path))
     {
-        if (it.element->GetType() != TILE_ELEMENT_TYPE_PATH)
-            continue;
-
-        if (!(it.element)->AsPath()->HasAddition())
-            continue;
-
-        auto* pathBitEntry = it.element->AsPath()->GetAdditionEntry();
-        if (pathBitEntry->flags & PATH_BIT_FLAG_IS_BIN)
-            it.element->AsPath()->SetAdditionStatus(0xFF);
+        for (auto* pathElement : TileElementsView<PathElement>(tilePos.ToCoordsXY()))
+        {
+            if (!pathElement->HasAddition())
+                continue;
 
-    } while (tile_element_iterator_next(&it));
+            auto* pathBitEntry = pathElement->GetAdditionEntry();
+            if (pathBitEntry->flags & PATH_BIT_FLAG_IS_BIN)
+                pathElement->SetAdditionStatus(0xFF);
+        }
+    }
 
     gfx_invalidate_screen();
 }
@@ -11,6 +11,7 @@
 
 #include "../management/Finance.h"
 #include "../ride/RideData.h"
+#include "../ride/RideTileIndex.h"
 #include "../ride/Track.h"
 #include "../ride/TrackData.h"
 #include "../ride/TrackDesign.h"
@@ -552,6 +553,7 @@ GameActions::Result::Ptr TrackPlaceAction::Execute() const
         trackElement->SetRideIndex(_rideIndex);
         trackElement->SetTrackType(_trackType);
         trackElement->SetGhost(GetFlags() & GAME_COMMAND_FLAG_GHOST);
+        ride_tile_index_add_element(mapLoc, trackElement->as<TileElement>());
 
         switch (_trackType)
         {
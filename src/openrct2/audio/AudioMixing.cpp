@@ -0,0 +1,110 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "AudioMixing.h"
+
+#include <algorithm>
+#include <cmath>
+
+// SSE2 is part of the x86-64 baseline, so this path is available without any runtime detection
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    define OPENRCT2_AUDIO_SSE2
+#    include <emmintrin.h>
+#endif
+
+namespace OpenRCT2::Audio
+{
+    static int16_t SaturateS16(int32_t value)
+    {
+        return static_cast<int16_t>(std::clamp<int32_t>(value, INT16_MIN, INT16_MAX));
+    }
+
+    void MixS16Scalar(int16_t* dst, const int16_t* src, size_t numFrames, int32_t numChannels, MixGain start, MixGain end)
+    {
+        if (numFrames == 0 || numChannels <= 0)
+            return;
+
+        const float stepL = (end.Left - start.Left) / numFrames;
+        const float stepR = (end.Right - start.Right) / numFrames;
+        for (size_t frame = 0; frame < numFrames; frame++)
+        {
+            // Derive the gain from the frame index rather than accumulating it to avoid drift over long buffers
+            const float gainL = start.Left + stepL * frame;
+            const float gainR = start.Right + stepR * frame;
+            for (int32_t channel = 0; channel < numChannels; channel++)
+            {
+                const float gain = (numChannels == 2 && channel == 1) ? gainR : gainL;
+                const auto sample = static_cast<int32_t>(std::lrint(static_cast<float>(*src) * gain));
+                *dst = SaturateS16(*dst + sample);
+                src++;
+                dst++;
+            }
+        }
+    }
+
+    void MixS16(int16_t* dst, const int16_t* src, size_t numFrames, int32_t numChannels, MixGain start, MixGain end)
+    {
+#ifdef OPENRCT2_AUDIO_SSE2
+        if (numFrames != 0 && (numChannels == 1 || numChannels == 2))
+        {
+            // Each iteration processes 8 samples, i.e. 8 mono frames or 4 stereo frames
+            constexpr int32_t SamplesPerBlock = 8;
+            const int32_t framesPerBlock = SamplesPerBlock / numChannels;
+            const float stepL = (end.Left - start.Left) / numFrames;
+            const float stepR = (end.Right - start.Right) / numFrames;
+
+            float laneGain[SamplesPerBlock];
+            float laneStep[SamplesPerBlock];
+            for (int32_t lane = 0; lane < SamplesPerBlock; lane++)
+            {
+                const int32_t frame = lane / numChannels;
+                const bool isRight = numChannels == 2 && (lane % 2) == 1;
+                laneGain[lane] = isRight ? start.Right + stepR * frame : start.Left + stepL * frame;
+                laneStep[lane] = (isRight ? stepR : stepL) * framesPerBlock;
+            }
+            const __m128 baseLo = _mm_loadu_ps(&laneGain[0]);
+            const __m128 baseHi = _mm_loadu_ps(&laneGain[4]);
+            const __m128 stepLo = _mm_loadu_ps(&laneStep[0]);
+            const __m128 stepHi = _mm_loadu_ps(&laneStep[4]);
+
+            const size_t numSamples = numFrames * numChannels;
+            size_t i = 0;
+            for (; i + SamplesPerBlock <= numSamples; i += SamplesPerBlock)
+            {
+                const __m128 block = _mm_set1_ps(static_cast<float>(i / SamplesPerBlock));
+                const __m128 gainLo = _mm_add_ps(baseLo, _mm_mul_ps(stepLo, block));
+                const __m128 gainHi = _mm_add_ps(baseHi, _mm_mul_ps(stepHi, block));
+
+                const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+                // Sign extend to 32-bit by placing each sample in the upper half and shifting back down
+                const __m128i inLo = _mm_srai_epi32(_mm_unpacklo_epi16(in, in), 16);
+                const __m128i inHi = _mm_srai_epi32(_mm_unpackhi_epi16(in, in), 16);
+                const __m128 scaledLo = _mm_mul_ps(_mm_cvtepi32_ps(inLo), gainLo);
+                const __m128 scaledHi = _mm_mul_ps(_mm_cvtepi32_ps(inHi), gainHi);
+                const __m128i scaled = _mm_packs_epi32(_mm_cvtps_epi32(scaledLo), _mm_cvtps_epi32(scaledHi));
+
+                const __m128i out = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_adds_epi16(out, scaled));
+            }
+
+            // Mix the remaining frames, continuing the ramp from where the vector loop stopped
+            const size_t framesDone = i / numChannels;
+            if (framesDone < numFrames)
+            {
+                MixGain tailStart;
+                tailStart.Left = start.Left + stepL * framesDone;
+                tailStart.Right = start.Right + stepR * framesDone;
+                MixS16Scalar(dst + i, src + i, numFrames - framesDone, numChannels, tailStart, end);
+            }
+            return;
+        }
+#endif
+        MixS16Scalar(dst, src, numFrames, numChannels, start, end);
+    }
+} // namespace OpenRCT2::Audio
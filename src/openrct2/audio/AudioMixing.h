@@ -0,0 +1,37 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+
+namespace OpenRCT2::Audio
+{
+    /**
+     * Gain applied to the left and right output channel, 1.0f being unity gain.
+     * Mono buffers only use the left gain.
+     */
+    struct MixGain
+    {
+        float Left = 1.0f;
+        float Right = 1.0f;
+    };
+
+    /**
+     * Mixes interleaved signed 16-bit PCM from src on to dst. The gain of each output
+     * channel is ramped linearly from start to end across the buffer which combines the
+     * pan, volume fade and mix steps into a single pass. The result is saturated.
+     */
+    void MixS16(int16_t* dst, const int16_t* src, size_t numFrames, int32_t numChannels, MixGain start, MixGain end);
+
+    /**
+     * Reference implementation of MixS16 which does not use any vector instructions.
+     */
+    void MixS16Scalar(int16_t* dst, const int16_t* src, size_t numFrames, int32_t numChannels, MixGain start, MixGain end);
+} // namespace OpenRCT2::Audio
@@ -0,0 +1,155 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "CommandLine.hpp"
+
+#ifdef USE_BENCHMARK
+
+#    include "../OpenRCT2.h"
+#    include "../audio/AudioContext.h"
+#    include "../audio/AudioMixing.h"
+#    include "../core/Console.hpp"
+#    include "../platform/platform.h"
+
+#    include <benchmark/benchmark.h>
+#    include <cmath>
+#    include <cstdint>
+#    include <vector>
+
+using namespace OpenRCT2;
+using namespace OpenRCT2::Audio;
+
+// Matches the buffer size and format requested by the SDL audio mixer
+constexpr int32_t MixFrames = 2048;
+constexpr int32_t MixChannels = 2;
+
+using MixFunc = void (*)(int16_t*, const int16_t*, size_t, int32_t, MixGain, MixGain);
+
+static std::vector<int16_t> CreateTestTone(int32_t seed)
+{
+    std::vector<int16_t> samples(MixFrames * MixChannels);
+    for (size_t i = 0; i < samples.size(); i++)
+    {
+        auto phase = static_cast<float>(i * (seed + 1)) * 0.01f;
+        samples[i] = static_cast<int16_t>(std::sin(phase) * 12000.0f);
+    }
+    return samples;
+}
+
+/**
+ * Mixes a number of panned and fading channels into one device sized chunk, which is
+ * what the audio callback has to do for a busy park.
+ */
+static void BM_mix(benchmark::State& state, MixFunc mixFunc)
+{
+    auto numChannels = static_cast<int32_t>(state.range(0));
+    std::vector<std::vector<int16_t>> sources;
+    std::vector<MixGain> startGains;
+    std::vector<MixGain> endGains;
+    for (int32_t i = 0; i < numChannels; i++)
+    {
+        sources.push_back(CreateTestTone(i));
+
+        float pan = static_cast<float>(i) / numChannels;
+        MixGain start;
+        start.Left = 0.5f * (1.0f - pan);
+        start.Right = 0.5f * pan;
+        MixGain end;
+        end.Left = 0.25f * (1.0f - pan);
+        end.Right = 0.25f * pan;
+        startGains.push_back(start);
+        endGains.push_back(end);
+    }
+
+    std::vector<int16_t> output(MixFrames * MixChannels);
+    for (auto _ : state)
+    {
+        std::fill(output.begin(), output.end(), 0);
+        for (int32_t i = 0; i < numChannels; i++)
+        {
+            mixFunc(output.data(), sources[i].data(), MixFrames, MixChannels, startGains[i], endGains[i]);
+        }
+        benchmark::DoNotOptimize(output.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * numChannels * MixFrames);
+}
+
+static int CmdlineForBenchAudio(int argc, const char* const* argv)
+{
+    benchmark::RegisterBenchmark("mix_scalar", BM_mix, MixS16Scalar)->RangeMultiplier(4)->Range(1, 64);
+    benchmark::RegisterBenchmark("mix", BM_mix, MixS16)->RangeMultiplier(4)->Range(1, 64);
+
+    // Google benchmark does stuff to argv. It doesn't modify the pointees,
+    // but it wants to reorder the pointers, so present a copy of them.
+    std::vector<char*> argv_for_benchmark;
+
+    // argv[0] is expected to contain the binary name. It's only for logging purposes, don't bother.
+    argv_for_benchmark.push_back(nullptr);
+    for (int i = 0; i < argc; i++)
+    {
+        argv_for_benchmark.push_back(const_cast<char*>(argv[i]));
+    }
+
+    // Update argc with all the changes made
+    argc = static_cast<int>(argv_for_benchmark.size());
+    ::benchmark::Initialize(&argc, &argv_for_benchmark[0]);
+    if (::benchmark::ReportUnrecognizedArguments(argc, &argv_for_benchmark[0]))
+        return -1;
+
+    core_init();
+    gOpenRCT2Headless = true;
+
+    // Run against the audio context of the headless runtime, it has no device or mixer so only the mixing kernels are
+    // measured. It is created once, the benchmarks themselves only call the kernels.
+    auto audioContext = CreateDummyAudioContext();
+    if (audioContext->GetMixer() != nullptr)
+    {
+        Console::Error::WriteLine("Expected the dummy audio context to have no mixer.");
+        return -1;
+    }
+
+    ::benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
+
+static exitcode_t HandleBenchAudio(CommandLineArgEnumerator* argEnumerator)
+{
+    const char* const* argv = static_cast<const char* const*>(argEnumerator->GetArguments()) + argEnumerator->GetIndex();
+    int32_t argc = argEnumerator->GetCount() - argEnumerator->GetIndex();
+    int32_t result = CmdlineForBenchAudio(argc, argv);
+    if (result < 0)
+    {
+        return EXITCODE_FAIL;
+    }
+    return EXITCODE_OK;
+}
+
+#else
+static exitcode_t HandleBenchAudio(CommandLineArgEnumerator* argEnumerator)
+{
+    log_error("Sorry, Google benchmark not enabled in this build");
+    return EXITCODE_FAIL;
+}
+#endif // USE_BENCHMARK
+
+const CommandLineCommand CommandLine::BenchAudioCommands[]{
+#ifdef USE_BENCHMARK
+    DefineCommand(
+        "",
+        "[--benchmark_list_tests={true|false}] [--benchmark_filter=<regex>] [--benchmark_min_time=<min_time>] "
+        "[--benchmark_repetitions=<num_repetitions>] [--benchmark_report_aggregates_only={true|false}] "
+        "[--benchmark_format=<console|json|csv>] [--benchmark_out=<filename>] [--benchmark_out_format=<json|console|csv>] "
+        "[--benchmark_color={auto|true|false}] [--benchmark_counters_tabular={true|false}] [--v=<verbosity>]",
+        nullptr, HandleBenchAudio),
+    CommandTableEnd
+#else
+    DefineCommand("", "*** SORRY NOT ENABLED IN THIS BUILD ***", nullptr, HandleBenchAudio), CommandTableEnd
+#endif // USE_BENCHMARK
+};
@@ -0,0 +1,239 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "CommandLine.hpp"
+
+#ifdef USE_BENCHMARK
+
+#    include "../Context.h"
+#    include "../Game.h"
+#    include "../Intro.h"
+#    include "../OpenRCT2.h"
+#    include "../drawing/Drawing.h"
+#    include "../interface/Viewport.h"
+#    include "../paint/Paint.h"
+#    include "../platform/Platform2.h"
+#    include "../world/Map.h"
+
+#    include <benchmark/benchmark.h>
+#    include <cstdint>
+#    include <memory>
+#    include <string>
+#    include <vector>
+
+using namespace OpenRCT2;
+
+// Size of the screen the hit-tests are spread over and the distance between them
+constexpr int32_t PickScreenWidth = 1920;
+constexpr int32_t PickScreenHeight = 1080;
+constexpr int32_t PickSpacing = 64;
+
+/**
+ * The 1x1 pixel views that get_map_coordinates_from_pos_window paints for a grid of cursor positions over a viewport
+ * centred on the map, along with their arranged paint sessions.
+ */
+struct PickBenchmarkData
+{
+    std::vector<rct_drawpixelinfo> Pixels;
+    std::vector<paint_session*> Sessions;
+
+    ~PickBenchmarkData()
+    {
+        for (auto* session : Sessions)
+        {
+            PaintSessionFree(session);
+        }
+    }
+};
+
+static std::unique_ptr<PickBenchmarkData> CreatePickBenchmarkData(ZoomLevel zoom)
+{
+    auto data = std::make_unique<PickBenchmarkData>();
+
+    int32_t centreX = (gMapSize / 2) * 32 + 16;
+    int32_t centreY = (gMapSize / 2) * 32 + 16;
+    int32_t z = tile_element_height({ centreX, centreY });
+    ScreenCoordsXY viewPos = { centreY - centreX - (PickScreenWidth * zoom) / 2,
+                               ((centreX + centreY) / 2) - z - (PickScreenHeight * zoom) / 2 };
+
+    for (int32_t y = 0; y < PickScreenHeight; y += PickSpacing)
+    {
+        for (int32_t x = 0; x < PickScreenWidth; x += PickSpacing)
+        {
+            ScreenCoordsXY viewLoc = { x * zoom, y * zoom };
+            viewLoc += viewPos;
+            if (zoom > 0)
+            {
+                viewLoc.x &= (0xFFFF * zoom) & 0xFFFF;
+                viewLoc.y &= (0xFFFF * zoom) & 0xFFFF;
+            }
+
+            rct_drawpixelinfo dpi;
+            dpi.x = viewLoc.x;
+            dpi.y = viewLoc.y;
+            dpi.height = 1;
+            dpi.zoom_level = zoom;
+            dpi.width = 1;
+            data->Pixels.push_back(dpi);
+
+            auto* session = PaintSessionAlloc(&dpi, 0);
+            PaintSessionGenerate(session);
+            PaintSessionArrange(session);
+            data->Sessions.push_back(session);
+        }
+    }
+    return data;
+}
+
+/**
+ * Only the sprite pixel tests of a hit-test, which is all that is left to do when the arranged paint session is reused.
+ */
+static void BM_pick(benchmark::State& state, const PickBenchmarkData* data)
+{
+    for (auto _ : state)
+    {
+        for (auto* session : data->Sessions)
+        {
+            auto info = set_interaction_info_from_paint_session(session, 0xFFFF);
+            benchmark::DoNotOptimize(info);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * data->Sessions.size());
+}
+
+/**
+ * A complete hit-test as done by get_map_coordinates_from_pos_window.
+ */
+static void BM_paint_and_pick(benchmark::State& state, const PickBenchmarkData* data)
+{
+    for (auto _ : state)
+    {
+        for (auto dpi : data->Pixels)
+        {
+            auto* session = PaintSessionAlloc(&dpi, 0);
+            PaintSessionGenerate(session);
+            PaintSessionArrange(session);
+            auto info = set_interaction_info_from_paint_session(session, 0xFFFF);
+            benchmark::DoNotOptimize(info);
+            PaintSessionFree(session);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * data->Pixels.size());
+}
+
+static int CmdlineForBenchPicking(int argc, const char* const* argv)
+{
+    // Google benchmark does stuff to argv. It doesn't modify the pointees,
+    // but it wants to reorder the pointers, so present a copy of them.
+    std::vector<char*> argv_for_benchmark;
+
+    // argv[0] is expected to contain the binary name. It's only for logging purposes, don't bother.
+    argv_for_benchmark.push_back(nullptr);
+
+    // Extract file names from argument list. If there is no such file, consider it benchmark option.
+    std::vector<std::string> parkFiles;
+    for (int i = 0; i < argc; i++)
+    {
+        if (Platform::FileExists(argv[i]))
+        {
+            parkFiles.emplace_back(argv[i]);
+        }
+        else
+        {
+            argv_for_benchmark.push_back(const_cast<char*>(argv[i]));
+        }
+    }
+    if (parkFiles.empty())
+    {
+        log_error("No park files given.");
+        return -1;
+    }
+
+    core_init();
+    gOpenRCT2Headless = true;
+    auto context = CreateContext();
+    if (!context->Initialise())
+    {
+        return -1;
+    }
+    drawing_engine_init();
+
+    // The sprites have to stay loaded while the benchmarks run, so only one park can be measured at a time
+    if (!context->LoadParkFromFile(parkFiles[0]))
+    {
+        log_error("Failed to load park!");
+        return -1;
+    }
+    if (parkFiles.size() > 1)
+    {
+        log_warning("Only the first park is benchmarked.");
+    }
+
+    gIntroState = IntroState::None;
+    gScreenFlags = SCREEN_FLAGS_PLAYING;
+    gCurrentRotation = 0;
+
+    // Ensure sprites appear regardless of rotation
+    reset_all_sprite_quadrant_placements();
+
+    std::vector<std::unique_ptr<PickBenchmarkData>> benchmarkData;
+    for (int8_t zoom = 0; zoom <= 2; zoom++)
+    {
+        auto& data = benchmarkData.emplace_back(CreatePickBenchmarkData(zoom));
+        auto suffix = "/zoom:" + std::to_string(zoom);
+        benchmark::RegisterBenchmark(("pick" + suffix).c_str(), BM_pick, data.get());
+        benchmark::RegisterBenchmark(("paint_and_pick" + suffix).c_str(), BM_paint_and_pick, data.get());
+    }
+
+    // Update argc with all the changes made
+    argc = static_cast<int>(argv_for_benchmark.size());
+    ::benchmark::Initialize(&argc, &argv_for_benchmark[0]);
+    if (::benchmark::ReportUnrecognizedArguments(argc, &argv_for_benchmark[0]))
+        return -1;
+    ::benchmark::RunSpecifiedBenchmarks();
+
+    benchmarkData.clear();
+    drawing_engine_dispose();
+    return 0;
+}
+
+static exitcode_t HandleBenchPicking(CommandLineArgEnumerator* argEnumerator)
+{
+    const char* const* argv = static_cast<const char* const*>(argEnumerator->GetArguments()) + argEnumerator->GetIndex();
+    int32_t argc = argEnumerator->GetCount() - argEnumerator->GetIndex();
+    int32_t result = CmdlineForBenchPicking(argc, argv);
+    if (result < 0)
+    {
+        return EXITCODE_FAIL;
+    }
+    return EXITCODE_OK;
+}
+
+#else
+static exitcode_t HandleBenchPicking(CommandLineArgEnumerator* argEnumerator)
+{
+    log_error("Sorry, Google benchmark not enabled in this build");
+    return EXITCODE_FAIL;
+}
+#endif // USE_BENCHMARK
+
+const CommandLineCommand CommandLine::BenchPickingCommands[]{
+#ifdef USE_BENCHMARK
+    DefineCommand(
+        "",
+        "<file> [--benchmark_list_tests={true|false}] [--benchmark_filter=<regex>] [--benchmark_min_time=<min_time>] "
+        "[--benchmark_repetitions=<num_repetitions>] [--benchmark_report_aggregates_only={true|false}] "
+        "[--benchmark_format=<console|json|csv>] [--benchmark_out=<filename>] [--benchmark_out_format=<json|console|csv>] "
+        "[--benchmark_color={auto|true|false}] [--benchmark_counters_tabular={true|false}] [--v=<verbosity>]",
+        nullptr, HandleBenchPicking),
+    CommandTableEnd
+#else
+    DefineCommand("", "*** SORRY NOT ENABLED IN THIS BUILD ***", nullptr, HandleBenchPicking), CommandTableEnd
+#endif // USE_BENCHMARK
+};
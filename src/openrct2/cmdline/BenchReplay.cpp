@@ -0,0 +1,466 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "CommandLine.hpp"
+
+#ifdef USE_BENCHMARK
+
+#    include "../Context.h"
+#    include "../GameState.h"
+#    include "../OpenRCT2.h"
+#    include "../ReplayManager.h"
+#    include "../core/Console.hpp"
+#    include "../core/FileScanner.h"
+#    include "../core/Json.hpp"
+#    include "../core/Path.hpp"
+#    include "../core/String.hpp"
+#    include "../platform/Platform2.h"
+#    include "../platform/platform.h"
+
+#    include <algorithm>
+#    include <array>
+#    include <atomic>
+#    include <chrono>
+#    include <cstdlib>
+#    include <iterator>
+#    include <new>
+#    include <string>
+#    include <vector>
+
+using namespace OpenRCT2;
+
+static char* _baselinePath = nullptr;
+static char* _outputPath = nullptr;
+static int32_t _tolerance = 10;
+static int32_t _parkTicks = 2000;
+static int32_t _seekTick = 0;
+
+#    ifdef ENABLE_ALLOCATION_COUNTING
+// Allocations are counted by replacing the global allocation functions, which affects every binary linking the library,
+// so this is only done in builds configured with ENABLE_ALLOCATION_COUNTING. Only allocations made while a workload is
+// being measured are counted, which is a relaxed load and increment.
+static std::atomic<bool> _countAllocations;
+static std::atomic<uint64_t> _allocationCount;
+
+void* operator new(std::size_t size)
+{
+    if (_countAllocations.load(std::memory_order_relaxed))
+    {
+        _allocationCount.fetch_add(1, std::memory_order_relaxed);
+    }
+    if (size == 0)
+    {
+        size = 1;
+    }
+    while (true)
+    {
+        auto* ptr = std::malloc(size);
+        if (ptr != nullptr)
+        {
+            return ptr;
+        }
+        auto handler = std::get_new_handler();
+        if (handler == nullptr)
+        {
+            throw std::bad_alloc();
+        }
+        handler();
+    }
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    try
+    {
+        return operator new(size);
+    }
+    catch (const std::bad_alloc&)
+    {
+        return nullptr;
+    }
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return operator new(size, std::nothrow);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+#    endif // ENABLE_ALLOCATION_COUNTING
+
+using PartTimes = std::array<std::chrono::duration<double, std::milli>, LOGIC_TIME_PART_COUNT>;
+
+class WorkloadTimer
+{
+private:
+    using Clock = std::chrono::high_resolution_clock;
+
+    LogicTimings _timings;
+    PartTimes _partTimes{};
+    uint32_t _ticks{};
+#    ifdef ENABLE_ALLOCATION_COUNTING
+    uint64_t _allocationsAtStart{};
+#    endif
+    Clock::time_point _startTime;
+
+public:
+    WorkloadTimer()
+    {
+        // Create every entry up front so the measured ticks do not include the allocations for them
+        for (size_t i = 0; i < LOGIC_TIME_PART_COUNT; i++)
+        {
+            _timings.TimingInfo[static_cast<LogicTimePart>(i)] = {};
+        }
+    }
+
+    void Start()
+    {
+#    ifdef ENABLE_ALLOCATION_COUNTING
+        _allocationsAtStart = _allocationCount.load(std::memory_order_relaxed);
+        _countAllocations = true;
+#    endif
+        _startTime = Clock::now();
+    }
+
+    void Tick(GameState& gameState)
+    {
+        auto idx = _timings.CurrentIdx;
+        gameState.UpdateLogic(&_timings);
+        _ticks++;
+
+        // Every part is reported as the time since the start of the tick in the order of LogicTimePart, so subtract the
+        // part before it
+        std::chrono::duration<double> previous{};
+        for (size_t i = 0; i < LOGIC_TIME_PART_COUNT; i++)
+        {
+            auto& reported = _timings.TimingInfo[static_cast<LogicTimePart>(i)][idx];
+            if (reported.count() > 0)
+            {
+                _partTimes[i] += reported - previous;
+                previous = reported;
+                reported = {};
+            }
+        }
+    }
+
+    json_t Stop(const std::string& name)
+    {
+        std::chrono::duration<double, std::milli> totalTime = Clock::now() - _startTime;
+
+        json_t parts = json_t::object();
+        for (size_t i = 0; i < LOGIC_TIME_PART_COUNT; i++)
+        {
+            parts[GetLogicTimePartName(static_cast<LogicTimePart>(i))] = _partTimes[i].count();
+        }
+
+        json_t result = {
+            { "name", name },
+            { "ticks", _ticks },
+            { "total_ms", totalTime.count() },
+            { "ticks_per_second", totalTime.count() > 0 ? _ticks / (totalTime.count() / 1000.0) : 0.0 },
+            { "parts_ms", parts },
+        };
+#    ifdef ENABLE_ALLOCATION_COUNTING
+        _countAllocations = false;
+        auto allocations = _allocationCount.load(std::memory_order_relaxed) - _allocationsAtStart;
+        result["allocations_per_tick"] = _ticks > 0 ? static_cast<double>(allocations) / _ticks : 0.0;
+#    endif
+        return result;
+    }
+};
+
+static json_t RunReplayWorkload(IContext& context, const std::string& path)
+{
+    auto& gameState = *context.GetGameState();
+    auto* replayManager = context.GetReplayManager();
+    if (!replayManager->StartPlayback(path))
+    {
+        return { { "name", path }, { "error", "Unable to start replay." } };
+    }
+    // Only the ticks after the seek are measured
+    if (_seekTick > 0 && !replayManager->Seek(static_cast<uint32_t>(_seekTick)))
+    {
+        replayManager->StopPlayback();
+        return { { "name", path }, { "error", "Unable to seek replay." } };
+    }
+
+    WorkloadTimer timer;
+    timer.Start();
+    bool mismatch = false;
+    while (replayManager->IsReplaying())
+    {
+        timer.Tick(gameState);
+        if (replayManager->IsPlaybackStateMismatching())
+        {
+            mismatch = true;
+            break;
+        }
+    }
+    auto result = timer.Stop(path);
+    if (mismatch)
+    {
+        replayManager->StopPlayback();
+        result["error"] = "Replay state mismatch.";
+    }
+    return result;
+}
+
+static json_t RunParkWorkload(IContext& context, const std::string& path, uint32_t ticks)
+{
+    if (!context.LoadParkFromFile(path))
+    {
+        return { { "name", path }, { "error", "Unable to load park." } };
+    }
+
+    auto& gameState = *context.GetGameState();
+    WorkloadTimer timer;
+    timer.Start();
+    for (uint32_t i = 0; i < ticks; i++)
+    {
+        timer.Tick(gameState);
+    }
+    return timer.Stop(path);
+}
+
+static const json_t* FindBaselineResult(const json_t& baseline, const std::string& name)
+{
+    auto results = baseline.find("results");
+    if (results == baseline.end() || !results->is_array())
+    {
+        return nullptr;
+    }
+    for (const auto& result : *results)
+    {
+        auto it = result.find("name");
+        if (it != result.end() && it->is_string() && it->get<std::string>() == name)
+        {
+            return &result;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * Compares a result to the one with the same name in the baseline and describes every metric that got worse by more
+ * than the tolerance. Part timings are too noisy on their own so only the totals are checked.
+ */
+static std::vector<std::string> FindRegressions(const json_t& result, const json_t& baseline, double tolerance)
+{
+    std::vector<std::string> regressions;
+    auto name = result["name"].get<std::string>();
+    auto check = [&](const char* metric, bool higherIsBetter, double slack) {
+        auto it = baseline.find(metric);
+        auto current = result.find(metric);
+        if (it == baseline.end() || current == result.end() || !it->is_number() || !current->is_number())
+        {
+            return;
+        }
+        auto expected = it->get<double>();
+        auto actual = current->get<double>();
+        bool regressed = higherIsBetter ? actual < expected * (1.0 - tolerance) - slack
+                                        : actual > expected * (1.0 + tolerance) + slack;
+        if (regressed)
+        {
+            regressions.push_back(String::StdFormat("%s: %s is %.2f, baseline %.2f", name.c_str(), metric, actual, expected));
+        }
+    };
+    check("ticks_per_second", true, 0);
+    // Ignore changes of less than one allocation per tick
+    check("allocations_per_tick", false, 1);
+    check("peak_memory_bytes", false, 0);
+    return regressions;
+}
+
+static int CmdlineForBenchReplay(const std::vector<std::string>& paths)
+{
+    // Directories are searched for replays, anything else is run as given
+    std::vector<std::string> replayFiles;
+    std::vector<std::string> parkFiles;
+    for (const auto& path : paths)
+    {
+        if (Path::DirectoryExists(path))
+        {
+            auto scanner = Path::ScanDirectory(Path::Combine(path, "*.sv6r"), true);
+            while (scanner->Next())
+            {
+                replayFiles.emplace_back(scanner->GetPath());
+            }
+        }
+        else if (!Platform::FileExists(path))
+        {
+            log_error("'%s' does not exist.", path.c_str());
+            return -1;
+        }
+        else if (String::Equals(Path::GetExtension(path), ".sv6r", true))
+        {
+            replayFiles.push_back(path);
+        }
+        else
+        {
+            parkFiles.push_back(path);
+        }
+    }
+    if (replayFiles.empty() && parkFiles.empty())
+    {
+        log_error("No replays or parks given.");
+        return -1;
+    }
+
+    json_t baseline;
+    if (_baselinePath != nullptr)
+    {
+        baseline = Json::ReadFromFile(_baselinePath);
+    }
+
+    core_init();
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = true;
+    auto context = CreateContext();
+    if (!context->Initialise())
+    {
+        return -1;
+    }
+
+    json_t results = json_t::array();
+    for (const auto& path : replayFiles)
+    {
+        Console::Error::WriteLine("Replaying '%s'...", path.c_str());
+        results.push_back(RunReplayWorkload(*context, path));
+    }
+    for (const auto& path : parkFiles)
+    {
+        Console::Error::WriteLine("Running '%s' for %d ticks...", path.c_str(), _parkTicks);
+        results.push_back(RunParkWorkload(*context, path, static_cast<uint32_t>(std::max(_parkTicks, 0))));
+    }
+
+    bool failed = false;
+    json_t regressions = json_t::array();
+    for (const auto& result : results)
+    {
+        if (result.find("error") != result.end())
+        {
+            failed = true;
+            continue;
+        }
+
+        auto* baselineResult = FindBaselineResult(baseline, result["name"].get<std::string>());
+        if (baselineResult != nullptr)
+        {
+            for (auto& regression : FindRegressions(result, *baselineResult, _tolerance / 100.0))
+            {
+                Console::Error::WriteLine("Regression: %s", regression.c_str());
+                regressions.push_back(std::move(regression));
+            }
+        }
+    }
+
+    // The peak resident size only ever grows, so it is measured over all workloads of the run rather than per workload
+    json_t process = { { "name", "process" }, { "peak_memory_bytes", Platform::GetPeakMemoryUsage() } };
+    for (auto& regression : FindRegressions(process, baseline, _tolerance / 100.0))
+    {
+        Console::Error::WriteLine("Regression: %s", regression.c_str());
+        regressions.push_back(std::move(regression));
+    }
+
+    json_t report = {
+        { "results", results },
+        { "peak_memory_bytes", process["peak_memory_bytes"] },
+        { "regressions", regressions },
+    };
+    if (_outputPath != nullptr)
+    {
+        Json::WriteToFile(_outputPath, report);
+    }
+    else
+    {
+        Console::WriteLine("%s", report.dump(4).c_str());
+    }
+
+    if (failed || !regressions.empty())
+    {
+        return -1;
+    }
+    return 0;
+}
+
+static exitcode_t HandleBenchReplay(CommandLineArgEnumerator* argEnumerator)
+{
+    // Options always come last, so every argument up to the first one is a replay, park or directory
+    std::vector<std::string> paths;
+    const char* argument;
+    while (argEnumerator->TryPopString(&argument) && argument[0] != '-')
+    {
+        paths.emplace_back(argument);
+    }
+
+    try
+    {
+        if (CmdlineForBenchReplay(paths) < 0)
+        {
+            return EXITCODE_FAIL;
+        }
+    }
+    catch (const std::exception& e)
+    {
+        Console::Error::WriteLine("%s", e.what());
+        return EXITCODE_FAIL;
+    }
+    return EXITCODE_OK;
+}
+
+// clang-format off
+static constexpr const CommandLineOptionDefinition BenchReplayOptions[]
+{
+    { CMDLINE_TYPE_STRING,  &_baselinePath, NAC, "baseline",  "results of an earlier run to check for regressions against"      },
+    { CMDLINE_TYPE_INTEGER, &_tolerance,    NAC, "tolerance", "percentage a result may be worse than the baseline (default 10)" },
+    { CMDLINE_TYPE_INTEGER, &_parkTicks,    NAC, "ticks",     "number of ticks to run parks for (default 2000)"                 },
+    { CMDLINE_TYPE_INTEGER, &_seekTick,     NAC, "seek",      "tick to start replays from, using the closest keyframe"          },
+    { CMDLINE_TYPE_STRING,  &_outputPath,   NAC, "output",    "file to write the results to instead of stdout"                  },
+    OptionTableEnd
+};
+// clang-format on
+
+#else
+static exitcode_t HandleBenchReplay(CommandLineArgEnumerator* argEnumerator)
+{
+    log_error("Sorry, Google benchmark not enabled in this build");
+    return EXITCODE_FAIL;
+}
+#endif // USE_BENCHMARK
+
+const CommandLineCommand CommandLine::BenchReplayCommands[]{
+#ifdef USE_BENCHMARK
+    DefineCommand("", "<replay|park|directory>...", BenchReplayOptions, HandleBenchReplay), CommandTableEnd
+#else
+    DefineCommand("", "*** SORRY NOT ENABLED IN THIS BUILD ***", nullptr, HandleBenchReplay), CommandTableEnd
+#endif // USE_BENCHMARK
+};
@@ -0,0 +1,188 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "CommandLine.hpp"
+
+#ifdef USE_BENCHMARK
+
+#    include "../Context.h"
+#    include "../OpenRCT2.h"
+#    include "../ParkImporter.h"
+#    include "../core/FileScanner.h"
+#    include "../core/MemoryStream.h"
+#    include "../core/Path.hpp"
+#    include "../core/String.hpp"
+#    include "../platform/Platform2.h"
+#    include "../rct2/RCT2.h"
+#    include "../scenario/ScenarioRepository.h"
+
+#    include <benchmark/benchmark.h>
+#    include <string>
+#    include <vector>
+
+using namespace OpenRCT2;
+
+// Same file types as the scenario index picks up
+static constexpr auto ScenarioPattern = "*.sc4;*.sc6;*.sea";
+
+/**
+ * Reads every scenario the way the scenario index does when the cache is cold, decoding only the parts of
+ * each file the index entry is made from.
+ */
+static void BM_scenario_index_header(benchmark::State& state, const std::vector<std::string>* files)
+{
+    size_t numRead = 0;
+    for (auto _ : state)
+    {
+        for (const auto& path : *files)
+        {
+            scenario_index_entry entry;
+            if (scenario_repository_read_entry(path, &entry))
+            {
+                numRead++;
+            }
+            benchmark::DoNotOptimize(entry);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * files->size());
+    state.counters["read"] = static_cast<double>(numRead) / state.iterations();
+}
+
+/**
+ * Reads every scenario by loading the whole park with its importer, including the object check done before
+ * a park is opened. This is the baseline the header only path is compared against.
+ */
+static void BM_scenario_index_full(benchmark::State& state, const std::vector<std::string>* files)
+{
+    size_t numRead = 0;
+    for (auto _ : state)
+    {
+        for (const auto& path : *files)
+        {
+            scenario_index_entry entry;
+            try
+            {
+                auto importer = ParkImporter::Create(path);
+                if (String::Equals(Path::GetExtension(path), ".sea", true))
+                {
+                    auto data = DecryptSea(fs::u8path(path));
+                    auto ms = MemoryStream(data.data(), data.size(), MEMORY_ACCESS::READ);
+                    importer->LoadFromStream(&ms, true, false, path.c_str());
+                }
+                else
+                {
+                    importer->LoadScenario(path.c_str());
+                }
+                if (importer->GetDetails(&entry))
+                {
+                    numRead++;
+                }
+            }
+            catch (const std::exception&)
+            {
+            }
+            benchmark::DoNotOptimize(entry);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * files->size());
+    state.counters["read"] = static_cast<double>(numRead) / state.iterations();
+}
+
+static int CmdlineForBenchScenarioIndex(int argc, const char* const* argv)
+{
+    // Google benchmark does stuff to argv. It doesn't modify the pointees,
+    // but it wants to reorder the pointers, so present a copy of them.
+    std::vector<char*> argv_for_benchmark;
+
+    // argv[0] is expected to contain the binary name. It's only for logging purposes, don't bother.
+    argv_for_benchmark.push_back(nullptr);
+
+    // Extract scenario files and directories from argument list. Anything else is considered a benchmark option.
+    std::vector<std::string> scenarioFiles;
+    for (int i = 0; i < argc; i++)
+    {
+        if (Path::DirectoryExists(argv[i]))
+        {
+            auto scanner = Path::ScanDirectory(Path::Combine(argv[i], ScenarioPattern), true);
+            while (scanner->Next())
+            {
+                scenarioFiles.emplace_back(scanner->GetPath());
+            }
+        }
+        else if (Platform::FileExists(argv[i]))
+        {
+            scenarioFiles.emplace_back(argv[i]);
+        }
+        else
+        {
+            argv_for_benchmark.push_back(const_cast<char*>(argv[i]));
+        }
+    }
+    if (scenarioFiles.empty())
+    {
+        log_error("No scenario files given.");
+        return -1;
+    }
+
+    core_init();
+    gOpenRCT2Headless = true;
+    auto context = CreateContext();
+    if (!context->Initialise())
+    {
+        return -1;
+    }
+
+    log_info("Benchmarking %zu scenario files.", scenarioFiles.size());
+    benchmark::RegisterBenchmark("scenario_index/header", BM_scenario_index_header, &scenarioFiles);
+    benchmark::RegisterBenchmark("scenario_index/full", BM_scenario_index_full, &scenarioFiles);
+
+    // Update argc with all the changes made
+    argc = static_cast<int>(argv_for_benchmark.size());
+    ::benchmark::Initialize(&argc, &argv_for_benchmark[0]);
+    if (::benchmark::ReportUnrecognizedArguments(argc, &argv_for_benchmark[0]))
+        return -1;
+    ::benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
+
+static exitcode_t HandleBenchScenarioIndex(CommandLineArgEnumerator* argEnumerator)
+{
+    const char* const* argv = static_cast<const char* const*>(argEnumerator->GetArguments()) + argEnumerator->GetIndex();
+    int32_t argc = argEnumerator->GetCount() - argEnumerator->GetIndex();
+    int32_t result = CmdlineForBenchScenarioIndex(argc, argv);
+    if (result < 0)
+    {
+        return EXITCODE_FAIL;
+    }
+    return EXITCODE_OK;
+}
+
+#else
+static exitcode_t HandleBenchScenarioIndex(CommandLineArgEnumerator* argEnumerator)
+{
+    log_error("Sorry, Google benchmark not enabled in this build");
+    return EXITCODE_FAIL;
+}
+#endif // USE_BENCHMARK
+
+const CommandLineCommand CommandLine::BenchScenariosCommands[]{
+#ifdef USE_BENCHMARK
+    DefineCommand(
+        "",
+        "<directory|file>... [--benchmark_list_tests={true|false}] [--benchmark_filter=<regex>] "
+        "[--benchmark_min_time=<min_time>] [--benchmark_repetitions=<num_repetitions>] "
+        "[--benchmark_report_aggregates_only={true|false}] [--benchmark_format=<console|json|csv>] "
+        "[--benchmark_out=<filename>] [--benchmark_out_format=<json|console|csv>] [--benchmark_color={auto|true|false}] "
+        "[--benchmark_counters_tabular={true|false}] [--v=<verbosity>]",
+        nullptr, HandleBenchScenarioIndex),
+    CommandTableEnd
+#else
+    DefineCommand("", "*** SORRY NOT ENABLED IN THIS BUILD ***", nullptr, HandleBenchScenarioIndex), CommandTableEnd
+#endif // USE_BENCHMARK
+};
@@ -49,14 +49,18 @@ static void BM_update(benchmark::State& state, const std::string& filename)
             context->GetGameState()->UpdateLogic(timingToUse);
         }
         state.SetItemsProcessed(state.iterations());
-        auto accumulator = [timings](LogicTimePart part) -> double {
-            std::chrono::duration<double> timesum;
+        auto accumulator = [&timings](LogicTimePart part) -> double {
+            std::chrono::duration<double, std::milli> timesum{};
             for (const auto& timing : timings)
             {
-                timesum = std::accumulate(
-                    timing.TimingInfo.at(part).begin(), timing.TimingInfo.at(part).end(), std::chrono::duration<double>());
+                // Parts that are not compiled in, such as scripts, never get a timing
+                auto it = timing.TimingInfo.find(part);
+                if (it != timing.TimingInfo.end())
+                {
+                    timesum += std::accumulate(it->second.begin(), it->second.end(), std::chrono::duration<double>());
+                }
             }
-            return std::chrono::duration_cast<std::chrono::milliseconds>(timesum).count();
+            return timesum.count();
         };
         state.counters["NetworkUpdateAcc_ms"] = accumulator(LogicTimePart::NetworkUpdate);
         state.counters["DateAcc_ms"] = accumulator(LogicTimePart::Date);
@@ -119,7 +119,12 @@ namespace CommandLine
     extern const CommandLineCommand BenchGfxCommands[];
     extern const CommandLineCommand BenchSpriteSortCommands[];
     extern const CommandLineCommand BenchUpdateCommands[];
+    extern const CommandLineCommand BenchAudioCommands[];
+    extern const CommandLineCommand BenchPickingCommands[];
+    extern const CommandLineCommand BenchScenariosCommands[];
+    extern const CommandLineCommand BenchReplayCommands[];
     extern const CommandLineCommand SimulateCommands[];
+    extern const CommandLineCommand SimulateBatchCommands[];
 
     extern const CommandLineExample RootExamples[];
 
@@ -17,6 +17,7 @@
 #include "../core/Memory.hpp"
 #include "../core/Path.hpp"
 #include "../core/String.hpp"
+#include "../core/Trace.h"
 #include "../localisation/Language.h"
 #include "../network/network.h"
 #include "../object/ObjectRepository.h"
@@ -58,6 +59,9 @@ static utf8* _openrct2DataPath = nullptr;
 static utf8* _rct1DataPath = nullptr;
 static utf8* _rct2DataPath = nullptr;
 static bool _silentBreakpad = false;
+#ifndef DISABLE_TRACING
+static utf8* _tracePath = nullptr;
+#endif
 
 // clang-format off
 static constexpr const CommandLineOptionDefinition StandardOptions[]
@@ -81,6 +85,9 @@ static constexpr const CommandLineOptionDefinition StandardOptions[]
 #ifdef USE_BREAKPAD
     { CMDLINE_TYPE_SWITCH,  &_silentBreakpad,  NAC, "silent-breakpad",   "make breakpad crash reporting silent"                       },
 #endif // USE_BREAKPAD
+#ifndef DISABLE_TRACING
+    { CMDLINE_TYPE_STRING,  &_tracePath,        NAC, "trace",              "record a performance trace and write it to the given file on exit" },
+#endif
     OptionTableEnd
 };
 
@@ -141,7 +148,12 @@ const CommandLineCommand CommandLine::RootCommands[]
     DefineSubCommand("benchgfx",        CommandLine::BenchGfxCommands         ),
     DefineSubCommand("benchspritesort", CommandLine::BenchSpriteSortCommands  ),
     DefineSubCommand("benchsimulate",   CommandLine::BenchUpdateCommands      ),
+    DefineSubCommand("benchaudio",      CommandLine::BenchAudioCommands       ),
+    DefineSubCommand("benchpicking",    CommandLine::BenchPickingCommands     ),
+    DefineSubCommand("benchscenarios",  CommandLine::BenchScenariosCommands   ),
+    DefineSubCommand("benchreplay",     CommandLine::BenchReplayCommands      ),
     DefineSubCommand("simulate",        CommandLine::SimulateCommands         ),
+    DefineSubCommand("simulate-batch",  CommandLine::SimulateBatchCommands    ),
     CommandTableEnd
 };
 
@@ -231,6 +243,16 @@ exitcode_t CommandLine::HandleCommandDefault()
         Memory::Free(_password);
     }
 
+#ifndef DISABLE_TRACING
+    if (_tracePath != nullptr)
+    {
+        utf8 absolutePath[MAX_PATH]{};
+        Path::GetAbsolute(absolutePath, std::size(absolutePath), _tracePath);
+        Trace::Start(absolutePath);
+        Memory::Free(_tracePath);
+    }
+#endif
+
     return result;
 }
 
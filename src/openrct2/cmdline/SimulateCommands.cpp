@@ -12,22 +12,60 @@
 #include "../GameState.h"
 #include "../OpenRCT2.h"
 #include "../core/Console.hpp"
+#include "../core/Json.hpp"
+#include "../management/Finance.h"
 #include "../network/network.h"
+#include "../peep/Peep.h"
 #include "../platform/platform.h"
+#include "../scenario/Scenario.h"
+#include "../world/Park.h"
 #include "../world/Sprite.h"
 #include "CommandLine.hpp"
 
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
 #include <cstdlib>
 #include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifndef _WIN32
+#    include <sys/wait.h>
+#    include <unistd.h>
+#endif
 
 using namespace OpenRCT2;
 
+static int32_t _batchWorkers = 0;
+static int32_t _batchSeeds = 0;
+
 static exitcode_t HandleSimulate(CommandLineArgEnumerator* argEnumerator);
+static exitcode_t HandleSimulateBatch(CommandLineArgEnumerator* argEnumerator);
 
 const CommandLineCommand CommandLine::SimulateCommands[]{ // Main commands
                                                           DefineCommand("", "<ticks>", nullptr, HandleSimulate), CommandTableEnd
 };
 
+// clang-format off
+static constexpr const CommandLineOptionDefinition SimulateBatchOptions[]
+{
+    { CMDLINE_TYPE_INTEGER, &_batchWorkers, 'j', "workers", "number of parks to simulate at the same time (default: number of CPU threads)" },
+    { CMDLINE_TYPE_INTEGER, &_batchSeeds,   NAC, "seeds",   "simulate every park once for each of this many random seeds" },
+    OptionTableEnd
+};
+
+const CommandLineCommand CommandLine::SimulateBatchCommands[]
+{
+    // Main commands
+    DefineCommand("", "<ticks> <file>...", SimulateBatchOptions, HandleSimulateBatch),
+    CommandTableEnd
+};
+// clang-format on
+
 static exitcode_t HandleSimulate(CommandLineArgEnumerator* argEnumerator)
 {
     const char** argv = const_cast<const char**>(argEnumerator->GetArguments()) + argEnumerator->GetIndex();
@@ -73,3 +111,285 @@ static exitcode_t HandleSimulate(CommandLineArgEnumerator* argEnumerator)
 
     return EXITCODE_OK;
 }
+
+struct SimulationJob
+{
+    std::string ParkPath;
+    std::optional<uint32_t> Seed;
+};
+
+/**
+ * Loads the park of the job into the given context and runs it for the given number of ticks. The result is a single
+ * JSON object with the final state of the park and how long it took.
+ */
+static json_t RunSimulationJob(IContext& context, const SimulationJob& job, uint32_t ticks)
+{
+    using Clock = std::chrono::high_resolution_clock;
+    using Milliseconds = std::chrono::duration<double, std::milli>;
+
+    json_t result = { { "park", job.ParkPath } };
+    if (job.Seed)
+    {
+        result["seed"] = *job.Seed;
+    }
+
+    auto loadStart = Clock::now();
+    if (!context.LoadParkFromFile(job.ParkPath))
+    {
+        result["error"] = "Failed to load park.";
+        return result;
+    }
+    if (job.Seed)
+    {
+        scenario_rand_seed(*job.Seed, *job.Seed);
+    }
+
+    auto updateStart = Clock::now();
+    Milliseconds maxTickTime{};
+    for (uint32_t i = 0; i < ticks; i++)
+    {
+        auto tickStart = Clock::now();
+        context.GetGameState()->UpdateLogic();
+        maxTickTime = std::max<Milliseconds>(maxTickTime, Clock::now() - tickStart);
+    }
+    auto updateEnd = Clock::now();
+
+    Milliseconds loadTime = updateStart - loadStart;
+    Milliseconds updateTime = updateEnd - updateStart;
+    result["ticks"] = ticks;
+    result["checksum"] = sprite_checksum().ToString();
+    result["park_rating"] = gParkRating;
+    result["cash"] = gCash;
+    result["guests"] = gNumGuestsInPark;
+    result["load_ms"] = loadTime.count();
+    result["update_ms"] = updateTime.count();
+    result["max_tick_ms"] = maxTickTime.count();
+    result["ticks_per_second"] = updateTime.count() > 0 ? ticks / (updateTime.count() / 1000.0) : 0.0;
+    return result;
+}
+
+static void WriteSimulationResult(const json_t& result)
+{
+    Console::WriteLine("%s", result.dump().c_str());
+    std::fflush(stdout);
+}
+
+#ifndef _WIN32
+static void WriteToPipe(int fd, const std::string& data)
+{
+    size_t written = 0;
+    while (written < data.size())
+    {
+        auto n = write(fd, data.data() + written, data.size() - written);
+        if (n <= 0)
+        {
+            break;
+        }
+        written += n;
+    }
+}
+
+static std::string ReadFromPipe(int fd)
+{
+    std::string data;
+    char buffer[1024];
+    ssize_t n;
+    while ((n = read(fd, buffer, sizeof(buffer))) > 0)
+    {
+        data.append(buffer, n);
+    }
+    return data;
+}
+
+/**
+ * Runs every job in its own forked copy of this process, so the loaded objects, sprites and language are shared with
+ * the workers copy-on-write instead of being loaded again for each park. Each worker sends its result line back over a
+ * pipe, which is read once the worker has exited; a result is a single short line so it always fits in the pipe buffer.
+ */
+static bool RunSimulationJobs(IContext& context, const std::vector<SimulationJob>& jobs, uint32_t ticks, size_t maxWorkers)
+{
+    struct Worker
+    {
+        pid_t Pid;
+        int Fd;
+        const SimulationJob* Job;
+    };
+
+    // Anything still buffered would otherwise be written again by every worker
+    std::fflush(stdout);
+    std::fflush(stderr);
+
+    bool success = true;
+    std::vector<Worker> workers;
+    size_t nextJob = 0;
+    while (nextJob < jobs.size() || !workers.empty())
+    {
+        while (nextJob < jobs.size() && workers.size() < maxWorkers)
+        {
+            const auto& job = jobs[nextJob++];
+            int fds[2];
+            if (pipe(fds) != 0)
+            {
+                Console::Error::WriteLine("Unable to create pipe for '%s'.", job.ParkPath.c_str());
+                success = false;
+                continue;
+            }
+
+            auto pid = fork();
+            if (pid == 0)
+            {
+                close(fds[0]);
+                auto result = RunSimulationJob(context, job, ticks);
+                WriteToPipe(fds[1], result.dump() + "\n");
+                close(fds[1]);
+                std::fflush(stdout);
+                std::fflush(stderr);
+                // Skip the destructors, the context belongs to the parent process
+                _exit(result.find("error") != result.end() ? EXIT_FAILURE : EXIT_SUCCESS);
+            }
+
+            close(fds[1]);
+            if (pid < 0)
+            {
+                Console::Error::WriteLine("Unable to start worker for '%s'.", job.ParkPath.c_str());
+                close(fds[0]);
+                success = false;
+                continue;
+            }
+            workers.push_back({ pid, fds[0], &job });
+        }
+
+        if (workers.empty())
+        {
+            continue;
+        }
+
+        int status;
+        auto pid = waitpid(-1, &status, 0);
+        if (pid < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            Console::Error::WriteLine("Lost track of the simulation workers.");
+            return false;
+        }
+
+        auto it = std::find_if(workers.begin(), workers.end(), [pid](const Worker& worker) { return worker.Pid == pid; });
+        if (it == workers.end())
+        {
+            continue;
+        }
+
+        auto output = ReadFromPipe(it->Fd);
+        close(it->Fd);
+        if (!output.empty())
+        {
+            output.pop_back();
+            Console::WriteLine("%s", output.c_str());
+            std::fflush(stdout);
+        }
+        else
+        {
+            json_t result = { { "park", it->Job->ParkPath } };
+            if (it->Job->Seed)
+            {
+                result["seed"] = *it->Job->Seed;
+            }
+            if (WIFSIGNALED(status))
+            {
+                result["error"] = "Worker was terminated by signal " + std::to_string(WTERMSIG(status)) + ".";
+            }
+            else
+            {
+                result["error"] = "Worker exited without a result.";
+            }
+            WriteSimulationResult(result);
+        }
+
+        if (!WIFEXITED(status) || WEXITSTATUS(status) != EXIT_SUCCESS)
+        {
+            success = false;
+        }
+        workers.erase(it);
+    }
+    return success;
+}
+#else
+/**
+ * There is no fork on Windows, so the jobs are run one after another in this process. Loading a park replaces the
+ * previous one completely so the shared assets are still only loaded once.
+ */
+static bool RunSimulationJobs(
+    IContext& context, const std::vector<SimulationJob>& jobs, uint32_t ticks, [[maybe_unused]] size_t maxWorkers)
+{
+    bool success = true;
+    for (const auto& job : jobs)
+    {
+        auto result = RunSimulationJob(context, job, ticks);
+        if (result.find("error") != result.end())
+        {
+            success = false;
+        }
+        WriteSimulationResult(result);
+    }
+    return success;
+}
+#endif // _WIN32
+
+static exitcode_t HandleSimulateBatch(CommandLineArgEnumerator* argEnumerator)
+{
+    int32_t ticks;
+    if (!argEnumerator->TryPopInteger(&ticks) || ticks < 0)
+    {
+        Console::Error::WriteLine("Expected number of ticks.");
+        return EXITCODE_FAIL;
+    }
+
+    // Options always come last, so every argument up to the first one is a park
+    std::vector<std::string> parkPaths;
+    const char* argument;
+    while (argEnumerator->TryPopString(&argument) && argument[0] != '-')
+    {
+        parkPaths.emplace_back(argument);
+    }
+    if (parkPaths.empty())
+    {
+        Console::Error::WriteLine("Expected at least one park file.");
+        return EXITCODE_FAIL;
+    }
+
+    std::vector<SimulationJob> jobs;
+    for (const auto& parkPath : parkPaths)
+    {
+        if (_batchSeeds <= 0)
+        {
+            jobs.push_back({ parkPath, std::nullopt });
+        }
+        for (int32_t seed = 0; seed < _batchSeeds; seed++)
+        {
+            jobs.push_back({ parkPath, static_cast<uint32_t>(seed) });
+        }
+    }
+
+    size_t maxWorkers = _batchWorkers > 0 ? _batchWorkers : std::max(1U, std::thread::hardware_concurrency());
+
+    core_init();
+    gOpenRCT2Headless = true;
+
+    std::unique_ptr<IContext> context(CreateContext());
+    if (!context->Initialise())
+    {
+        Console::Error::WriteLine("Context initialization failed.");
+        return EXITCODE_FAIL;
+    }
+
+    Console::Error::WriteLine(
+        "Running %zu simulations of %d ticks with up to %zu workers...", jobs.size(), ticks, maxWorkers);
+    if (!RunSimulationJobs(*context, jobs, static_cast<uint32_t>(ticks), maxWorkers))
+    {
+        return EXITCODE_FAIL;
+    }
+    return EXITCODE_OK;
+}
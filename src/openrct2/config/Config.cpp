@@ -422,6 +422,8 @@ namespace Config
             model->log_server_actions = reader->GetBoolean("log_server_actions", false);
             model->pause_server_if_no_clients = reader->GetBoolean("pause_server_if_no_clients", false);
             model->desync_debugging = reader->GetBoolean("desync_debugging", false);
+            model->metrics_port = reader->GetInt32("metrics_port", 0);
+            model->metrics_address = reader->GetString("metrics_address", "127.0.0.1");
         }
     }
 
@@ -449,6 +451,8 @@ namespace Config
         writer->WriteBoolean("log_server_actions", model->log_server_actions);
         writer->WriteBoolean("pause_server_if_no_clients", model->pause_server_if_no_clients);
         writer->WriteBoolean("desync_debugging", model->desync_debugging);
+        writer->WriteInt32("metrics_port", model->metrics_port);
+        writer->WriteString("metrics_address", model->metrics_address);
     }
 
     static void ReadNotifications(IIniReader* reader)
@@ -162,6 +162,8 @@ struct NetworkConfiguration
     bool log_server_actions;
     bool pause_server_if_no_clients;
     bool desync_debugging;
+    int32_t metrics_port;
+    std::string metrics_address;
 };
 
 struct NotificationConfiguration
@@ -18,35 +18,46 @@
 #include "JobPool.h"
 #include "Path.hpp"
 
+#include <algorithm>
 #include <chrono>
-#include <list>
 #include <string>
+#include <string_view>
 #include <tuple>
+#include <unordered_map>
 #include <vector>
 
 template<typename TItem> class FileIndex
 {
 private:
-    struct DirectoryStats
+    struct ScannedFile
     {
-        uint32_t TotalFiles = 0;
-        uint64_t TotalFileSize = 0;
-        uint32_t FileDateModifiedChecksum = 0;
-        uint32_t PathChecksum = 0;
+        std::string Path;
+        uint64_t Size = 0;
+        uint64_t LastModified = 0;
     };
 
     struct ScanResult
     {
-        DirectoryStats const Stats;
-        std::vector<std::string> const Files;
+        std::vector<ScannedFile> const Files;
 
-        ScanResult(DirectoryStats stats, std::vector<std::string> files)
-            : Stats(stats)
-            , Files(files)
+        explicit ScanResult(std::vector<ScannedFile> files)
+            : Files(std::move(files))
         {
         }
     };
 
+    /**
+     * The index stores an entry for every scanned file, including those that did not produce an item, so that only
+     * files that have been added or changed since the index was written need to be loaded again.
+     */
+    struct IndexEntry
+    {
+        ScannedFile File;
+        bool HasItem = false;
+        TItem Item{};
+        float ParseTime = 0;
+    };
+
     struct FileIndexHeader
     {
         uint32_t HeaderSize = sizeof(FileIndexHeader);
@@ -54,12 +65,11 @@ private:
         uint8_t VersionA = 0;
         uint8_t VersionB = 0;
         uint16_t LanguageId = 0;
-        DirectoryStats Stats;
-        uint32_t NumItems = 0;
+        uint32_t NumEntries = 0;
     };
 
     // Index file format version which when incremented forces a rebuild
-    static constexpr uint8_t FILE_INDEX_VERSION = 4;
+    static constexpr uint8_t FILE_INDEX_VERSION = 5;
 
     std::string const _name;
     uint32_t const _magicNumber;
@@ -95,31 +105,20 @@ public:
     virtual ~FileIndex() = default;
 
     /**
-     * Queries and directories and loads the index header. If the index is up to date,
-     * the items are loaded from the index and returned, otherwise the index is rebuilt.
+     * Queries the directories and loads the index. Items of files that have not changed since the index was written
+     * are taken from the index, only new or modified files are loaded again.
      */
     std::vector<TItem> LoadOrBuild(int32_t language) const
     {
-        std::vector<TItem> items;
         auto scanResult = Scan();
-        auto readIndexResult = ReadIndexFile(language, scanResult.Stats);
-        if (std::get<0>(readIndexResult))
-        {
-            // Index was loaded
-            items = std::get<1>(readIndexResult);
-        }
-        else
-        {
-            // Index was not loaded
-            items = Build(language, scanResult);
-        }
-        return items;
+        auto readIndexResult = ReadIndexFile(language);
+        return Build(language, scanResult, std::move(std::get<1>(readIndexResult)));
     }
 
     std::vector<TItem> Rebuild(int32_t language) const
     {
         auto scanResult = Scan();
-        auto items = Build(language, scanResult);
+        auto items = Build(language, scanResult, {});
         return items;
     }
 
@@ -138,8 +137,7 @@ protected:
 private:
     ScanResult Scan() const
     {
-        DirectoryStats stats{};
-        std::vector<std::string> files;
+        std::vector<ScannedFile> files;
         for (const auto& directory : SearchPaths)
         {
             auto absoluteDirectory = Path::GetAbsolute(directory);
@@ -150,107 +148,170 @@ private:
             while (scanner->Next())
             {
                 auto fileInfo = scanner->GetFileInfo();
-                auto path = std::string(scanner->GetPath());
 
-                stats.TotalFiles++;
-                stats.TotalFileSize += fileInfo->Size;
-                stats.FileDateModifiedChecksum ^= static_cast<uint32_t>(fileInfo->LastModified >> 32)
-                    ^ static_cast<uint32_t>(fileInfo->LastModified & 0xFFFFFFFF);
-                stats.FileDateModifiedChecksum = ror32(stats.FileDateModifiedChecksum, 5);
-                stats.PathChecksum += GetPathChecksum(path);
-
-                files.push_back(std::move(path));
+                ScannedFile file;
+                file.Path = std::string(scanner->GetPath());
+                file.Size = fileInfo->Size;
+                file.LastModified = fileInfo->LastModified;
+                files.push_back(std::move(file));
             }
         }
-        return ScanResult(stats, files);
+        return ScanResult(std::move(files));
     }
 
     void BuildRange(
-        int32_t language, const ScanResult& scanResult, size_t rangeStart, size_t rangeEnd, std::vector<TItem>& items,
-        std::atomic<size_t>& processed, std::mutex& printLock) const
+        int32_t language, const std::vector<size_t>& toLoad, size_t rangeStart, size_t rangeEnd,
+        std::vector<IndexEntry>& entries, std::atomic<size_t>& processed, std::mutex& printLock) const
     {
-        items.reserve(rangeEnd - rangeStart);
         for (size_t i = rangeStart; i < rangeEnd; i++)
         {
-            const auto& filePath = scanResult.Files.at(i);
+            auto& entry = entries[toLoad[i]];
+            const auto& filePath = entry.File.Path;
 
-            if (_log_levels[static_cast<uint8_t>(DiagnosticLevel::Verbose)])
+            auto startTime = std::chrono::high_resolution_clock::now();
+            auto item = Create(language, filePath);
+            auto endTime = std::chrono::high_resolution_clock::now();
+
+            entry.HasItem = std::get<0>(item);
+            if (entry.HasItem)
             {
-                std::lock_guard<std::mutex> lock(printLock);
-                log_verbose("FileIndex:Indexing '%s'", filePath.c_str());
+                entry.Item = std::move(std::get<1>(item));
             }
+            entry.ParseTime = std::chrono::duration<float, std::milli>(endTime - startTime).count();
 
-            auto item = Create(language, filePath);
-            if (std::get<0>(item))
+            if (_log_levels[static_cast<uint8_t>(DiagnosticLevel::Verbose)])
             {
-                items.push_back(std::get<1>(item));
+                std::lock_guard<std::mutex> lock(printLock);
+                log_verbose("FileIndex:Indexed '%s' in %.2f ms", filePath.c_str(), entry.ParseTime);
             }
 
             processed++;
         }
     }
 
-    std::vector<TItem> Build(int32_t language, const ScanResult& scanResult) const
+    std::vector<TItem> Build(int32_t language, const ScanResult& scanResult, std::vector<IndexEntry> cachedEntries) const
     {
-        std::vector<TItem> allItems;
-        Console::WriteLine("Building %s (%zu items)", _name.c_str(), scanResult.Files.size());
-
         auto startTime = std::chrono::high_resolution_clock::now();
 
-        const size_t totalCount = scanResult.Files.size();
-        if (totalCount > 0)
+        std::unordered_map<std::string_view, size_t> cachedEntryByPath;
+        cachedEntryByPath.reserve(cachedEntries.size());
+        for (size_t i = 0; i < cachedEntries.size(); i++)
+        {
+            cachedEntryByPath.emplace(cachedEntries[i].File.Path, i);
+        }
+
+        // Reuse the entries of files that are unchanged, anything else has to be loaded
+        std::vector<IndexEntry> entries(scanResult.Files.size());
+        std::vector<size_t> toLoad;
+        size_t numReused = 0;
+        size_t numChanged = 0;
+        for (size_t i = 0; i < scanResult.Files.size(); i++)
         {
-            JobPool jobPool;
-            std::mutex printLock; // For verbose prints.
+            const auto& file = scanResult.Files[i];
+            auto cached = cachedEntryByPath.find(file.Path);
+            if (cached != cachedEntryByPath.end())
+            {
+                auto& cachedEntry = cachedEntries[cached->second];
+                // The key views the path about to be moved
+                cachedEntryByPath.erase(cached);
+                if (cachedEntry.File.Size == file.Size && cachedEntry.File.LastModified == file.LastModified)
+                {
+                    entries[i] = std::move(cachedEntry);
+                    numReused++;
+                    continue;
+                }
+                numChanged++;
+            }
+            entries[i].File = file;
+            toLoad.push_back(i);
+        }
+        cachedEntryByPath.clear();
 
-            std::list<std::vector<TItem>> containers;
+        const size_t numRemoved = cachedEntries.size() - numReused - numChanged;
+        const bool isRebuild = numReused == 0;
+        if (!toLoad.empty() || numRemoved != 0)
+        {
+            if (isRebuild)
+            {
+                Console::WriteLine("Building %s (%zu items)", _name.c_str(), toLoad.size());
+            }
+            else
+            {
+                Console::WriteLine(
+                    "Updating %s (%zu new or changed, %zu removed, %zu unchanged)", _name.c_str(), toLoad.size(), numRemoved,
+                    numReused);
+            }
 
-            size_t stepSize = 100; // Handpicked, seems to work well with 4/8 cores.
+            LoadEntries(language, toLoad, entries);
+            WriteIndexFile(language, entries);
 
-            std::atomic<size_t> processed = ATOMIC_VAR_INIT(0);
+            auto endTime = std::chrono::high_resolution_clock::now();
+            auto duration = std::chrono::duration<float>(endTime - startTime);
+            Console::WriteLine(
+                "Finished %s %s in %.2f seconds.", isRebuild ? "building" : "updating", _name.c_str(), duration.count());
 
-            auto reportProgress = [&]() {
-                const size_t completed = processed;
-                Console::WriteFormat("File %5zu of %zu, done %3d%%\r", completed, totalCount, completed * 100 / totalCount);
-            };
+            auto slowest = std::max_element(toLoad.begin(), toLoad.end(), [&entries](size_t a, size_t b) {
+                return entries[a].ParseTime < entries[b].ParseTime;
+            });
+            if (slowest != toLoad.end())
+            {
+                const auto& entry = entries[*slowest];
+                log_verbose("FileIndex:Slowest file was '%s' at %.2f ms", entry.File.Path.c_str(), entry.ParseTime);
+            }
+        }
 
-            for (size_t rangeStart = 0; rangeStart < totalCount; rangeStart += stepSize)
+        std::vector<TItem> allItems;
+        allItems.reserve(entries.size());
+        for (auto& entry : entries)
+        {
+            if (entry.HasItem)
             {
-                if (rangeStart + stepSize > totalCount)
-                {
-                    stepSize = totalCount - rangeStart;
-                }
+                allItems.push_back(entry.Item);
+            }
+        }
+        return allItems;
+    }
 
-                auto& items = containers.emplace_back();
+    void LoadEntries(int32_t language, const std::vector<size_t>& toLoad, std::vector<IndexEntry>& entries) const
+    {
+        const size_t totalCount = toLoad.size();
+        if (totalCount == 0)
+            return;
 
-                jobPool.AddTask(std::bind(
-                    &FileIndex<TItem>::BuildRange, this, language, std::cref(scanResult), rangeStart, rangeStart + stepSize,
-                    std::ref(items), std::ref(processed), std::ref(printLock)));
+        JobPool jobPool;
+        std::mutex printLock; // For verbose prints.
 
-                reportProgress();
-            }
+        size_t stepSize = 100; // Handpicked, seems to work well with 4/8 cores.
 
-            jobPool.Join(reportProgress);
+        std::atomic<size_t> processed = ATOMIC_VAR_INIT(0);
 
-            for (const auto& itr : containers)
+        auto reportProgress = [&]() {
+            const size_t completed = processed;
+            Console::WriteFormat("File %5zu of %zu, done %3d%%\r", completed, totalCount, completed * 100 / totalCount);
+        };
+
+        for (size_t rangeStart = 0; rangeStart < totalCount; rangeStart += stepSize)
+        {
+            if (rangeStart + stepSize > totalCount)
             {
-                allItems.insert(allItems.end(), itr.begin(), itr.end());
+                stepSize = totalCount - rangeStart;
             }
-        }
 
-        WriteIndexFile(language, scanResult.Stats, allItems);
+            // Each task only writes to the entries of its own range
+            jobPool.AddTask(std::bind(
+                &FileIndex<TItem>::BuildRange, this, language, std::cref(toLoad), rangeStart, rangeStart + stepSize,
+                std::ref(entries), std::ref(processed), std::ref(printLock)));
 
-        auto endTime = std::chrono::high_resolution_clock::now();
-        auto duration = std::chrono::duration<float>(endTime - startTime);
-        Console::WriteLine("Finished building %s in %.2f seconds.", _name.c_str(), duration.count());
+            reportProgress();
+        }
 
-        return allItems;
+        jobPool.Join(reportProgress);
     }
 
-    std::tuple<bool, std::vector<TItem>> ReadIndexFile(int32_t language, const DirectoryStats& stats) const
+    std::tuple<bool, std::vector<IndexEntry>> ReadIndexFile(int32_t language) const
     {
         bool loadedItems = false;
-        std::vector<TItem> items;
+        std::vector<IndexEntry> entries;
         if (File::Exists(_indexPath))
         {
             try
@@ -258,22 +319,23 @@ private:
                 log_verbose("FileIndex:Loading index: '%s'", _indexPath.c_str());
                 auto fs = OpenRCT2::FileStream(_indexPath, OpenRCT2::FILE_MODE_OPEN);
 
-                // Read header, check if we need to re-scan
+                // Read header, check if the saved entries can be used at all
                 auto header = fs.ReadValue<FileIndexHeader>();
                 if (header.HeaderSize == sizeof(FileIndexHeader) && header.MagicNumber == _magicNumber
-                    && header.VersionA == FILE_INDEX_VERSION && header.VersionB == _version && header.LanguageId == language
-                    && header.Stats.TotalFiles == stats.TotalFiles && header.Stats.TotalFileSize == stats.TotalFileSize
-                    && header.Stats.FileDateModifiedChecksum == stats.FileDateModifiedChecksum
-                    && header.Stats.PathChecksum == stats.PathChecksum)
+                    && header.VersionA == FILE_INDEX_VERSION && header.VersionB == _version && header.LanguageId == language)
                 {
-                    items.reserve(header.NumItems);
+                    entries.resize(header.NumEntries);
                     DataSerialiser ds(false, fs);
-                    // Directory is the same, just read the saved items
-                    for (uint32_t i = 0; i < header.NumItems; i++)
+                    for (auto& entry : entries)
                     {
-                        TItem item;
-                        Serialise(ds, item);
-                        items.emplace_back(std::move(item));
+                        ds << entry.File.Path;
+                        ds << entry.File.Size;
+                        ds << entry.File.LastModified;
+                        ds << entry.HasItem;
+                        if (entry.HasItem)
+                        {
+                            Serialise(ds, entry.Item);
+                        }
                     }
                     loadedItems = true;
                 }
@@ -286,12 +348,13 @@ private:
             {
                 Console::Error::WriteLine("Unable to load index: '%s'.", _indexPath.c_str());
                 Console::Error::WriteLine("%s", e.what());
+                entries.clear();
             }
         }
-        return std::make_tuple(loadedItems, std::move(items));
+        return std::make_tuple(loadedItems, std::move(entries));
     }
 
-    void WriteIndexFile(int32_t language, const DirectoryStats& stats, std::vector<TItem>& items) const
+    void WriteIndexFile(int32_t language, std::vector<IndexEntry>& entries) const
     {
         try
         {
@@ -305,15 +368,21 @@ private:
             header.VersionA = FILE_INDEX_VERSION;
             header.VersionB = _version;
             header.LanguageId = language;
-            header.Stats = stats;
-            header.NumItems = static_cast<uint32_t>(items.size());
+            header.NumEntries = static_cast<uint32_t>(entries.size());
             fs.WriteValue(header);
 
             DataSerialiser ds(true, fs);
-            // Write items
-            for (auto& item : items)
+            // Write entries
+            for (auto& entry : entries)
             {
-                Serialise(ds, item);
+                ds << entry.File.Path;
+                ds << entry.File.Size;
+                ds << entry.File.LastModified;
+                ds << entry.HasItem;
+                if (entry.HasItem)
+                {
+                    Serialise(ds, entry.Item);
+                }
             }
         }
         catch (const std::exception& e)
@@ -322,19 +391,4 @@ private:
             Console::Error::WriteLine("%s", e.what());
         }
     }
-
-    static uint32_t GetPathChecksum(const std::string& path)
-    {
-        uint32_t hash = 0xD8430DED;
-        for (const utf8* ch = path.c_str(); *ch != '\0'; ch++)
-        {
-            hash += (*ch);
-            hash += (hash << 10);
-            hash ^= (hash >> 6);
-        }
-        hash += (hash << 3);
-        hash ^= (hash >> 11);
-        hash += (hash << 15);
-        return hash;
-    }
 };
@@ -9,6 +9,8 @@
 
 #include "JobPool.h"
 
+#include "Trace.h"
+
 #include <algorithm>
 #include <cassert>
 
@@ -112,7 +114,10 @@ void JobPool::ProcessQueue()
 
             lock.unlock();
 
-            taskData.WorkFn();
+            {
+                TRACE_SCOPE("JobPool::Task");
+                taskData.WorkFn();
+            }
 
             lock.lock();
 
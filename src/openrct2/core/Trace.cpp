@@ -0,0 +1,165 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "Trace.h"
+
+#include "../Diagnostic.h"
+#include "Json.hpp"
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Trace
+{
+    // Events kept per thread, roughly a second of a busy game
+    static constexpr size_t ThreadBufferCapacity = 1 << 15;
+
+    struct TraceEvent
+    {
+        const char* Name;
+        Clock::time_point Start;
+        Clock::time_point End;
+    };
+
+    struct ThreadBuffer
+    {
+        // Only contended while the trace is being written or reset
+        std::mutex Mutex;
+        uint32_t ThreadId{};
+        std::vector<TraceEvent> Events;
+        size_t Next{};
+    };
+
+    namespace Detail
+    {
+        std::atomic<bool> Recording;
+    }
+
+    static std::mutex _buffersMutex;
+    static std::vector<std::shared_ptr<ThreadBuffer>> _buffers;
+    static std::string _outputPath;
+    static Clock::time_point _startTime;
+
+    static ThreadBuffer& GetThreadBuffer()
+    {
+        // The list keeps the buffer alive after the thread exits so its events can still be written
+        thread_local std::shared_ptr<ThreadBuffer> buffer;
+        if (buffer == nullptr)
+        {
+            buffer = std::make_shared<ThreadBuffer>();
+            buffer->Events.reserve(ThreadBufferCapacity);
+
+            std::lock_guard<std::mutex> lock(_buffersMutex);
+            buffer->ThreadId = static_cast<uint32_t>(_buffers.size());
+            _buffers.push_back(buffer);
+        }
+        return *buffer;
+    }
+
+    void Start(const std::string& outputPath)
+    {
+        std::lock_guard<std::mutex> lock(_buffersMutex);
+        for (auto& buffer : _buffers)
+        {
+            std::lock_guard<std::mutex> bufferLock(buffer->Mutex);
+            buffer->Events.clear();
+            buffer->Next = 0;
+        }
+        _outputPath = outputPath;
+        _startTime = Clock::now();
+        Detail::Recording = true;
+    }
+
+    void Stop()
+    {
+        if (!Detail::Recording.exchange(false))
+            return;
+
+        std::string outputPath;
+        {
+            std::lock_guard<std::mutex> lock(_buffersMutex);
+            outputPath = std::move(_outputPath);
+            _outputPath.clear();
+        }
+        if (!outputPath.empty())
+        {
+            Write(outputPath);
+        }
+    }
+
+    void RecordEvent(const char* name, Clock::time_point start, Clock::time_point end)
+    {
+        auto& buffer = GetThreadBuffer();
+        std::lock_guard<std::mutex> lock(buffer.Mutex);
+        if (buffer.Events.size() < ThreadBufferCapacity)
+        {
+            buffer.Events.push_back({ name, start, end });
+        }
+        else
+        {
+            buffer.Events[buffer.Next] = { name, start, end };
+        }
+        buffer.Next = (buffer.Next + 1) % ThreadBufferCapacity;
+    }
+
+    bool Write(const std::string& path)
+    {
+        using Microseconds = std::chrono::duration<double, std::micro>;
+
+        json_t events = json_t::array();
+        std::lock_guard<std::mutex> lock(_buffersMutex);
+        for (auto& buffer : _buffers)
+        {
+            std::lock_guard<std::mutex> bufferLock(buffer->Mutex);
+            if (buffer->Events.empty())
+                continue;
+
+            events.push_back({
+                { "name", "thread_name" },
+                { "ph", "M" },
+                { "pid", 1 },
+                { "tid", buffer->ThreadId },
+                { "args", { { "name", "Thread " + std::to_string(buffer->ThreadId) } } },
+            });
+
+            // Once the buffer has wrapped the oldest event is the one that will be overwritten next
+            auto numEvents = buffer->Events.size();
+            auto first = numEvents < ThreadBufferCapacity ? 0 : buffer->Next;
+            for (size_t i = 0; i < numEvents; i++)
+            {
+                const auto& traceEvent = buffer->Events[(first + i) % numEvents];
+                if (traceEvent.Start < _startTime)
+                    continue;
+
+                events.push_back({
+                    { "name", traceEvent.Name },
+                    { "ph", "X" },
+                    { "pid", 1 },
+                    { "tid", buffer->ThreadId },
+                    { "ts", Microseconds(traceEvent.Start - _startTime).count() },
+                    { "dur", Microseconds(traceEvent.End - traceEvent.Start).count() },
+                });
+            }
+        }
+
+        try
+        {
+            json_t trace = { { "traceEvents", events }, { "displayTimeUnit", "ms" } };
+            Json::WriteToFile(path.c_str(), trace, -1);
+            log_info("Trace written to %s", path.c_str());
+            return true;
+        }
+        catch (const std::exception& e)
+        {
+            log_error("Unable to write trace to %s: %s", path.c_str(), e.what());
+            return false;
+        }
+    }
+} // namespace Trace
@@ -0,0 +1,98 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+
+#include <atomic>
+#include <chrono>
+#include <string>
+
+/*
+ * Records a timeline of what the game is doing on every thread, which can be written out in the Chrome trace event
+ * format and opened in chrome://tracing or the Perfetto UI. Every thread records into its own fixed size ring buffer, so
+ * only the most recent events are kept and recording never allocates once a thread has recorded its first event.
+ *
+ * Trace points are added with TRACE_SCOPE and cost a single relaxed load while nothing is being recorded. Building with
+ * DISABLE_TRACING removes them entirely.
+ */
+namespace Trace
+{
+    using Clock = std::chrono::steady_clock;
+
+    namespace Detail
+    {
+        extern std::atomic<bool> Recording;
+    }
+
+    inline bool IsRecording()
+    {
+        return Detail::Recording.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Discards any earlier events and starts recording. If an output path is given the trace is written there when
+     * recording is stopped.
+     */
+    void Start(const std::string& outputPath = {});
+
+    /**
+     * Stops recording, writing the trace to the path given to Start if there was one.
+     */
+    void Stop();
+
+    /**
+     * Writes the recorded events as Chrome trace JSON, returns false if the file could not be written.
+     */
+    bool Write(const std::string& path);
+
+    /**
+     * Records an event that has already finished. The name must outlive the trace, in practice it is a string literal.
+     */
+    void RecordEvent(const char* name, Clock::time_point start, Clock::time_point end);
+
+    class Scope
+    {
+    private:
+        const char* _name;
+        Clock::time_point _start;
+        bool _active;
+
+    public:
+        explicit Scope(const char* name)
+            : _name(name)
+            , _active(IsRecording())
+        {
+            if (_active)
+            {
+                _start = Clock::now();
+            }
+        }
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+        ~Scope()
+        {
+            if (_active)
+            {
+                RecordEvent(_name, _start, Clock::now());
+            }
+        }
+    };
+} // namespace Trace
+
+#ifndef DISABLE_TRACING
+#    define TRACE_CONCAT_INNER(a, b) a##b
+#    define TRACE_CONCAT(a, b) TRACE_CONCAT_INNER(a, b)
+#    define TRACE_SCOPE(name) Trace::Scope TRACE_CONCAT(_traceScope, __LINE__)(name)
+#else
+#    define TRACE_SCOPE(name)
+#endif
@@ -10,6 +10,7 @@
 #include "../OpenRCT2.h"
 #include "../core/Console.hpp"
 #include "../core/Guard.hpp"
+#include "../interface/Viewport.h"
 #include "../sprites.h"
 #include "Drawing.h"
 
@@ -225,6 +226,7 @@ void gfx_object_free_images(uint32_t baseImageId, uint32_t count)
             gfx_set_g1_element(imageId, &g1);
             drawing_engine_invalidate_image(imageId);
         }
+        viewport_clear_sprite_coverage_masks();
 
         FreeImageList(baseImageId, count);
     }
@@ -26,6 +26,7 @@
 #include "../core/Guard.hpp"
 #include "../core/Path.hpp"
 #include "../core/String.hpp"
+#include "../core/Trace.h"
 #include "../drawing/Drawing.h"
 #include "../drawing/Font.h"
 #include "../interface/Chat.h"
@@ -45,6 +46,7 @@
 #include "../ride/Ride.h"
 #include "../ride/RideData.h"
 #include "../ride/Vehicle.h"
+#include "../scripting/ScriptEngine.h"
 #include "../util/Util.h"
 #include "../windows/Intent.h"
 #include "../world/Climate.h"
@@ -1247,8 +1249,7 @@ static int32_t cc_remove_park_fences(InteractiveConsole& console, [[maybe_unused
 
 static int32_t cc_show_limits(InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
 {
-    map_reorganise_elements();
-    int32_t tileElementCount = gNextFreeTileElement - gTileElements - 1;
+    int32_t tileElementCount = map_get_num_tile_elements();
 
     int32_t rideCount = ride_get_count();
     int32_t spriteCount = 0;
@@ -1547,6 +1548,33 @@ static int32_t cc_replay_stop(InteractiveConsole& console, const arguments_t& ar
     return 0;
 }
 
+static int32_t cc_replay_seek(InteractiveConsole& console, const arguments_t& argv)
+{
+    if (network_get_mode() != NETWORK_MODE_NONE)
+    {
+        console.WriteFormatLine("This command is currently not supported in multiplayer mode.");
+        return 0;
+    }
+
+    if (argv.size() < 1)
+    {
+        console.WriteFormatLine("Parameters required <tick>");
+        return 0;
+    }
+
+    uint32_t tick = atol(argv[0].c_str());
+
+    auto* replayManager = OpenRCT2::GetContext()->GetReplayManager();
+    if (replayManager->Seek(tick))
+    {
+        console.WriteFormatLine("Replay at tick %u", tick);
+        return 1;
+    }
+
+    console.WriteFormatLine("Unable to seek to tick %u", tick);
+    return 0;
+}
+
 static int32_t cc_replay_normalise(InteractiveConsole& console, const arguments_t& argv)
 {
     if (network_get_mode() != NETWORK_MODE_NONE)
@@ -1634,6 +1662,105 @@ static int32_t cc_mp_desync(InteractiveConsole& console, const arguments_t& argv
     return 0;
 }
 
+static int32_t cc_plugin_stats(InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
+{
+#ifdef ENABLE_SCRIPTING
+    auto& scriptEngine = OpenRCT2::GetContext()->GetScriptEngine();
+    if (!argv.empty() && argv[0] == "reset")
+    {
+        for (const auto& plugin : scriptEngine.GetPlugins())
+        {
+            plugin->ResetHookCallStats();
+        }
+        console.WriteLine("Plugin hook statistics have been reset");
+        return 0;
+    }
+
+    struct Row
+    {
+        std::string Plugin;
+        std::string_view Hook;
+        OpenRCT2::Scripting::HookCallStats Stats;
+    };
+    std::vector<Row> rows;
+    for (const auto& plugin : scriptEngine.GetPlugins())
+    {
+        for (size_t i = 0; i < OpenRCT2::Scripting::NUM_HOOK_TYPES; i++)
+        {
+            auto hookType = static_cast<OpenRCT2::Scripting::HOOK_TYPE>(i);
+            const auto& stats = plugin->GetHookCallStats(hookType);
+            if (stats.Calls != 0)
+            {
+                Row row;
+                row.Plugin = plugin->GetMetadata().Name;
+                row.Hook = OpenRCT2::Scripting::GetHookTypeName(hookType);
+                row.Stats = stats;
+                rows.push_back(row);
+            }
+        }
+    }
+
+    if (rows.empty())
+    {
+        console.WriteLine("No plugin hooks have been called");
+        return 0;
+    }
+
+    // Most expensive first
+    std::sort(rows.begin(), rows.end(), [](const Row& a, const Row& b) { return a.Stats.Time > b.Stats.Time; });
+    console.WriteFormatLine("%-32s %-24s %10s %12s %10s", "Plugin", "Hook", "Calls", "Total (ms)", "Avg (us)");
+    for (const auto& row : rows)
+    {
+        auto totalMs = std::chrono::duration<double, std::milli>(row.Stats.Time).count();
+        auto averageUs = std::chrono::duration<double, std::micro>(row.Stats.Time).count() / row.Stats.Calls;
+        console.WriteFormatLine(
+            "%-32s %-24s %10llu %12.3f %10.3f", row.Plugin.c_str(), std::string(row.Hook).c_str(),
+            static_cast<unsigned long long>(row.Stats.Calls), totalMs, averageUs);
+    }
+#else
+    console.WriteLineError("Scripting is not enabled in this build");
+#endif
+    return 0;
+}
+
+static int32_t cc_trace(InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
+{
+#ifndef DISABLE_TRACING
+    if (!argv.empty() && argv[0] == "start")
+    {
+        std::string path;
+        if (argv.size() >= 2)
+        {
+            path = argv[1];
+        }
+        else
+        {
+            auto env = OpenRCT2::GetContext()->GetPlatformEnvironment();
+            path = Path::Combine(env->GetDirectoryPath(OpenRCT2::DIRBASE::USER), "trace.json");
+        }
+        Trace::Start(path);
+        console.WriteFormatLine("Trace recording started, it will be written to %s", path.c_str());
+        return 0;
+    }
+    if (!argv.empty() && argv[0] == "stop")
+    {
+        if (!Trace::IsRecording())
+        {
+            console.WriteLineError("Trace currently not recording");
+            return 1;
+        }
+        Trace::Stop();
+        console.WriteLine("Trace recording stopped");
+        return 0;
+    }
+    console.WriteLineError("Usage: trace start [file] | trace stop");
+    return 1;
+#else
+    console.WriteLineError("Tracing is not enabled in this build");
+    return 1;
+#endif
+}
+
 #pragma warning(push)
 #pragma warning(disable : 4702) // unreachable code
 static int32_t cc_abort([[maybe_unused]] InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
@@ -1795,6 +1922,7 @@ static constexpr const console_command console_command_table[] = {
     { "load_park", cc_load_park, "Load park from save directory or by absolute path", "load_park <filename>" },
     { "object_count", cc_object_count, "Shows the number of objects of each type in the scenario.", "object_count" },
     { "open", cc_open, "Opens the window with the give name.", "open <window>." },
+    { "plugin_stats", cc_plugin_stats, "Shows the number of calls and time spent in each plugin's hooks.", "plugin_stats [reset]" },
     { "quit", cc_close, "Closes the console.", "quit" },
     { "remove_park_fences", cc_remove_park_fences, "Removes all park fences from the surface", "remove_park_fences" },
     { "remove_unused_objects", cc_remove_unused_objects, "Removes all the unused objects from the object selection.", "remove_unused_objects" },
@@ -1806,12 +1934,14 @@ static constexpr const console_command console_command_table[] = {
     { "show_limits", cc_show_limits, "Shows the map data counts and limits.", "show_limits" },
     { "staff", cc_staff, "Staff management.", "staff <subcommand>" },
     { "terminate", cc_terminate, "Calls std::terminate(), for testing purposes only.", "terminate" },
+    { "trace", cc_trace, "Records a performance trace that can be opened in chrome://tracing or Perfetto.", "trace start [file] | trace stop" },
     { "variables", cc_variables, "Lists all the variables that can be used with get and sometimes set.", "variables" },
     { "windows", cc_windows, "Lists all the windows that can be opened.", "windows" },
     { "replay_startrecord", cc_replay_startrecord, "Starts recording a new replay.", "replay_startrecord <name> [max_ticks]"},
     { "replay_stoprecord", cc_replay_stoprecord, "Stops recording a new replay.", "replay_stoprecord"},
     { "replay_start", cc_replay_start, "Starts a replay", "replay_start <name>"},
     { "replay_stop", cc_replay_stop, "Stops the replay", "replay_stop"},
+    { "replay_seek", cc_replay_seek, "Moves the replay to a tick, simulating from the closest keyframe before it", "replay_seek <tick>"},
     { "replay_normalise", cc_replay_normalise, "Normalises the replay to remove all gaps", "replay_normalise <input file> <output file>"},
     { "mp_desync", cc_mp_desync, "Forces a multiplayer desync", "cc_mp_desync [desync_type, 0 = Random t-shirt color on random guest, 1 = Remove random guest ]"},
 
@@ -25,6 +25,7 @@
 #include "../util/Util.h"
 #include "../world/Climate.h"
 #include "../world/Map.h"
+#include "../world/MiniMap.h"
 #include "../world/Park.h"
 #include "../world/Surface.h"
 #include "Viewport.h"
@@ -827,3 +828,29 @@ void CaptureImage(const CaptureOptions& options)
 
     gCurrentRotation = backupRotation;
 }
+
+void CaptureMiniMap(const MiniMapCaptureOptions& options)
+{
+    // Kept around between captures so that only tiles changed since the last capture need to be redrawn
+    static std::unique_ptr<MiniMap> miniMap;
+    static int32_t miniMapSize;
+    if (miniMap == nullptr)
+    {
+        miniMap = std::make_unique<MiniMap>();
+    }
+    if (miniMapSize != gMapSize)
+    {
+        miniMapSize = gMapSize;
+        miniMap->InvalidateAll();
+    }
+    miniMap->SetType(options.Type);
+    miniMap->SetRotation(options.Rotation);
+    miniMap->Update();
+
+    auto outputPath = ResolveFilenameForCapture(options.Filename);
+    rct_drawpixelinfo dpi{};
+    dpi.bits = const_cast<uint8_t*>(miniMap->GetImageData());
+    dpi.width = MINI_MAP_SIZE;
+    dpi.height = MINI_MAP_SIZE;
+    WriteDpiToFile(outputPath, &dpi, gPalette);
+}
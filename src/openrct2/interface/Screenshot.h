@@ -19,6 +19,7 @@
 #include <string>
 
 struct rct_drawpixelinfo;
+enum class MiniMapType : uint8_t;
 
 extern uint8_t gScreenshotCountdown;
 
@@ -52,6 +53,13 @@ struct CaptureOptions
     bool Transparent{};
 };
 
+struct MiniMapCaptureOptions
+{
+    fs::path Filename;
+    uint8_t Rotation{};
+    MiniMapType Type{};
+};
+
 void screenshot_check();
 std::string screenshot_dump();
 std::string screenshot_dump_png(rct_drawpixelinfo* dpi);
@@ -62,3 +70,4 @@ int32_t cmdline_for_screenshot(const char** argv, int32_t argc, ScreenshotOption
 int32_t cmdline_for_gfxbench(const char** argv, int32_t argc);
 
 void CaptureImage(const CaptureOptions& options);
+void CaptureMiniMap(const MiniMapCaptureOptions& options);
@@ -16,6 +16,7 @@
 #include "../config/Config.h"
 #include "../core/Guard.hpp"
 #include "../core/JobPool.h"
+#include "../core/Trace.h"
 #include "../drawing/Drawing.h"
 #include "../drawing/IDrawingEngine.h"
 #include "../paint/Paint.h"
@@ -58,6 +59,21 @@ paint_entry* gNextFreePaintStruct;
 uint8_t gCurrentRotation;
 
 static uint32_t _currentImageType;
+
+// The arranged paint session of the last hit-test. Tools often hit-test the same pixel several times per frame with
+// different interaction flags, so it is reused until the viewport moves or the area around the pixel is invalidated.
+struct InteractionPaintCache
+{
+    paint_session* Session{};
+    const rct_viewport* Viewport{};
+    ScreenCoordsXY ViewPos;
+    ZoomLevel Zoom;
+    uint32_t ViewFlags{};
+    uint8_t Rotation{};
+    bool Valid{};
+};
+static InteractionPaintCache _interactionPaintCache;
+
 InteractionInfo::InteractionInfo(const paint_struct* ps)
     : Loc(ps->map_x, ps->map_y)
     , Element(ps->tileElement)
@@ -204,10 +220,20 @@ void viewport_remove(rct_viewport* viewport)
         return;
     }
     _viewports.erase(it);
+    viewport_reset_interaction_cache();
 }
 
 void viewports_invalidate(int32_t left, int32_t top, int32_t right, int32_t bottom, int32_t maxZoom)
 {
+    // Only changes to the pixel of the last hit-test affect its cached paint session
+    auto& cache = _interactionPaintCache;
+    const int32_t pixelSize = std::max(1, 1 * cache.Zoom);
+    if (cache.Valid && right >= cache.ViewPos.x && left < cache.ViewPos.x + pixelSize && bottom >= cache.ViewPos.y
+        && top < cache.ViewPos.y + pixelSize)
+    {
+        viewport_reset_interaction_cache();
+    }
+
     for (auto& vp : _viewports)
     {
         if (maxZoom == -1 || vp.zoom <= maxZoom)
@@ -910,16 +936,22 @@ static void record_session(
 static void viewport_fill_column(
     paint_session* session, std::vector<RecordedPaintSession>* recorded_sessions, size_t record_index)
 {
-    PaintSessionGenerate(session);
+    {
+        TRACE_SCOPE("PaintSessionGenerate");
+        PaintSessionGenerate(session);
+    }
     if (recorded_sessions != nullptr)
     {
         record_session(session, recorded_sessions, record_index);
     }
+    TRACE_SCOPE("PaintSessionArrange");
     PaintSessionArrange(session);
 }
 
 static void viewport_paint_column(paint_session* session)
 {
+    TRACE_SCOPE("PaintDrawStructs");
+
     if (session->ViewFlags
             & (VIEWPORT_FLAG_HIDE_VERTICAL | VIEWPORT_FLAG_HIDE_BASE | VIEWPORT_FLAG_UNDERGROUND_INSIDE
                | VIEWPORT_FLAG_CLIP_VIEW)
@@ -963,6 +995,8 @@ void viewport_paint(
     const rct_viewport* viewport, rct_drawpixelinfo* dpi, int16_t left, int16_t top, int16_t right, int16_t bottom,
     std::vector<RecordedPaintSession>* recorded_sessions)
 {
+    TRACE_SCOPE("viewport_paint");
+
     uint32_t viewFlags = viewport->flags;
     uint16_t width = right - left;
     uint16_t height = bottom - top;
@@ -1373,90 +1407,128 @@ static bool is_pixel_present_bmp(
     return (*index != 0);
 }
 
+// Maximum number of bytes spent on sprite coverage masks before they are all discarded
+static constexpr size_t SpriteCoverageMaskBudget = 4 * 1024 * 1024;
+
 /**
- * rct2: 0x0067933B, 0x00679788, 0x00679C4A, 0x0067A117
+ * One bit per pixel of an RLE sprite, set where a hit-test at the given rounding finds the sprite opaque.
  */
-static bool is_pixel_present_rle(const uint8_t* esi, int16_t x_start_point, int16_t y_start_point, int32_t round)
+struct SpriteCoverageMask
 {
-    uint16_t start_offset = esi[y_start_point * 2] | (esi[y_start_point * 2 + 1] << 8);
-    const uint8_t* ebx = esi + start_offset;
+    // The sprite data the mask was built from, object images can be replaced at the same index
+    const uint8_t* Data{};
+    int16_t Width{};
+    int16_t Height{};
+    size_t Stride{};
+    std::vector<uint64_t> Bits;
 
-    uint8_t last_data_line = 0;
-    while (!last_data_line)
+    bool IsSet(int32_t x, int32_t y) const
     {
-        int32_t no_pixels = *ebx++;
-        uint8_t gap_size = *ebx++;
-
-        last_data_line = no_pixels & 0x80;
-
-        no_pixels &= 0x7F;
+        return (Bits[y * Stride + x / 64] >> (x % 64)) & 1;
+    }
+};
 
-        ebx += no_pixels;
+static std::unordered_map<uint32_t, SpriteCoverageMask> _spriteCoverageMasks;
+static size_t _spriteCoverageMaskBytes;
 
-        if (round > 1)
-        {
-            if (gap_size % 2)
+/**
+ * Works out which pixels of an RLE sprite are hit when the sprite is drawn with the given rounding, which depends on
+ * the zoom level.
+ *  rct2: 0x0067933B, 0x00679788, 0x00679C4A, 0x0067A117
+ */
+static void sprite_coverage_mask_build(SpriteCoverageMask& mask, const rct_g1_element* g1, int32_t round)
+{
+    mask.Data = g1->offset;
+    mask.Width = g1->width;
+    mask.Height = g1->height;
+    mask.Stride = (std::max<int32_t>(g1->width, 0) + 63) / 64;
+    mask.Bits.assign(mask.Stride * std::max<int32_t>(g1->height, 0), 0);
+
+    for (int32_t y = 0; y < g1->height; y++)
+    {
+        const uint8_t* rle = g1->offset;
+        const uint8_t* data = rle + (rle[y * 2] | (rle[y * 2 + 1] << 8));
+        uint8_t lastDataLine = 0;
+        while (!lastDataLine)
+        {
+            int32_t numPixels = *data++;
+            uint8_t gapSize = *data++;
+            lastDataLine = numPixels & 0x80;
+            numPixels &= 0x7F;
+            data += numPixels;
+
+            if (round > 1 && gapSize % 2)
             {
-                gap_size++;
-                no_pixels--;
-                if (no_pixels == 0)
-                {
+                gapSize++;
+                numPixels--;
+                if (numPixels == 0)
                     continue;
-                }
             }
-        }
-
-        if (round == 4)
-        {
-            if (gap_size % 4)
+            if (round == 4 && gapSize % 4)
             {
-                gap_size += 2;
-                no_pixels -= 2;
-                if (no_pixels <= 0)
-                {
+                gapSize += 2;
+                numPixels -= 2;
+                if (numPixels <= 0)
                     continue;
-                }
             }
-        }
 
-        int32_t x_start = gap_size - x_start_point;
-        if (x_start <= 0)
-        {
-            no_pixels += x_start;
-            if (no_pixels <= 0)
+            // The original test also reports the pixel left of an empty run as present
+            int32_t start = gapSize;
+            if (round == 1 && numPixels == 0 && start > 0)
             {
-                continue;
+                start--;
+                numPixels = 1;
             }
 
-            x_start = 0;
-        }
-        else
-        {
-            // Do nothing?
-        }
-
-        x_start += no_pixels;
-        x_start--;
-        if (x_start > 0)
-        {
-            no_pixels -= x_start;
-            if (no_pixels <= 0)
+            const int32_t end = std::min<int32_t>(start + numPixels, g1->width);
+            for (int32_t x = start; x < end; x++)
             {
-                continue;
+                mask.Bits[y * mask.Stride + x / 64] |= uint64_t{ 1 } << (x % 64);
             }
         }
+    }
+}
+
+static const SpriteCoverageMask& sprite_coverage_mask_get(uint32_t imageIndex, const rct_g1_element* g1, int32_t round)
+{
+    // Rounding only matters for halving and for quartering, greater zoom levels round like halving
+    const uint32_t roundClass = round == 1 ? 0 : (round == 4 ? 2 : 1);
+    const uint32_t key = (imageIndex << 2) | roundClass;
 
-        if (round > 1)
+    auto it = _spriteCoverageMasks.find(key);
+    if (it != _spriteCoverageMasks.end() && it->second.Data == g1->offset && it->second.Width == g1->width
+        && it->second.Height == g1->height)
+    {
+        return it->second;
+    }
+
+    if (it == _spriteCoverageMasks.end())
+    {
+        if (_spriteCoverageMaskBytes >= SpriteCoverageMaskBudget)
         {
-            // This matches the original implementation, but allows empty lines to cause false positives on zoom 0
-            if (ceil2(no_pixels, round) == 0)
-                continue;
+            viewport_clear_sprite_coverage_masks();
         }
-
-        return true;
+        it = _spriteCoverageMasks.emplace(key, SpriteCoverageMask{}).first;
     }
 
-    return false;
+    auto& mask = it->second;
+    _spriteCoverageMaskBytes -= mask.Bits.size() * sizeof(uint64_t);
+    sprite_coverage_mask_build(mask, g1, round);
+    _spriteCoverageMaskBytes += mask.Bits.size() * sizeof(uint64_t);
+    return mask;
+}
+
+void viewport_clear_sprite_coverage_masks()
+{
+    _spriteCoverageMasks.clear();
+    _spriteCoverageMaskBytes = 0;
+}
+
+static bool is_pixel_present_rle(
+    uint32_t imageIndex, const rct_g1_element* g1, int16_t x_start_point, int16_t y_start_point, int32_t round)
+{
+    const auto& mask = sprite_coverage_mask_get(imageIndex, g1, round);
+    return mask.IsSet(x_start_point, y_start_point);
 }
 
 /**
@@ -1593,7 +1665,7 @@ static bool is_sprite_interacted_with_palette_set(
 
     if (g1->flags & G1_FLAG_RLE_COMPRESSION)
     {
-        return is_pixel_present_rle(g1->offset, xStartPoint, yStartPoint, round);
+        return is_pixel_present_rle(imageId & 0x7FFFF, g1, xStartPoint, yStartPoint, round);
     }
 
     uint8_t* offset = g1->offset + (yStartPoint * g1->width) + xStartPoint;
@@ -1720,22 +1792,51 @@ InteractionInfo get_map_coordinates_from_pos_window(rct_window* window, const Sc
             viewLoc.x &= (0xFFFF * myviewport->zoom) & 0xFFFF;
             viewLoc.y &= (0xFFFF * myviewport->zoom) & 0xFFFF;
         }
-        rct_drawpixelinfo dpi;
-        dpi.x = viewLoc.x;
-        dpi.y = viewLoc.y;
-        dpi.height = 1;
-        dpi.zoom_level = myviewport->zoom;
-        dpi.width = 1;
+        auto& cache = _interactionPaintCache;
+        if (!cache.Valid || cache.Viewport != myviewport || cache.ViewPos != viewLoc || cache.Zoom != myviewport->zoom
+            || cache.ViewFlags != myviewport->flags || cache.Rotation != get_current_rotation())
+        {
+            if (cache.Session != nullptr)
+            {
+                PaintSessionFree(cache.Session);
+            }
 
-        paint_session* session = PaintSessionAlloc(&dpi, myviewport->flags);
-        PaintSessionGenerate(session);
-        PaintSessionArrange(session);
-        info = set_interaction_info_from_paint_session(session, flags & 0xFFFF);
-        PaintSessionFree(session);
+            rct_drawpixelinfo dpi;
+            dpi.x = viewLoc.x;
+            dpi.y = viewLoc.y;
+            dpi.height = 1;
+            dpi.zoom_level = myviewport->zoom;
+            dpi.width = 1;
+
+            cache.Session = PaintSessionAlloc(&dpi, myviewport->flags);
+            PaintSessionGenerate(cache.Session);
+            PaintSessionArrange(cache.Session);
+            cache.Viewport = myviewport;
+            cache.ViewPos = viewLoc;
+            cache.Zoom = myviewport->zoom;
+            cache.ViewFlags = myviewport->flags;
+            cache.Rotation = get_current_rotation();
+            cache.Valid = true;
+        }
+        info = set_interaction_info_from_paint_session(cache.Session, flags & 0xFFFF);
     }
     return info;
 }
 
+void viewport_reset_interaction_cache()
+{
+    // The session itself is kept until the next hit-test, it is only released there or by its painter
+    _interactionPaintCache.Valid = false;
+}
+
+void viewport_release_interaction_cache()
+{
+    // The painter frees its sessions itself, handing this one back to it would go through a context being torn down
+    _interactionPaintCache.Session = nullptr;
+    _interactionPaintCache.Viewport = nullptr;
+    _interactionPaintCache.Valid = false;
+}
+
 /**
  * Left, top, right and bottom represent 2D map coordinates at zoom 0.
  */
@@ -137,6 +137,20 @@ void viewport_set_visibility(uint8_t mode);
 
 InteractionInfo get_map_coordinates_from_pos(const ScreenCoordsXY& screenCoords, int32_t flags);
 InteractionInfo get_map_coordinates_from_pos_window(rct_window* window, const ScreenCoordsXY& screenCoords, int32_t flags);
+/**
+ * Forces the next hit-test to repaint the pixel under the cursor. Called when something on screen changes without the
+ * viewports being invalidated.
+ */
+void viewport_reset_interaction_cache();
+/**
+ * Forgets the paint session kept for hit-testing. Called by the painter that owns the session before it is destroyed.
+ */
+void viewport_release_interaction_cache();
+/**
+ * Discards the pixel coverage of sprites used for hit-testing. Must be called when images are freed, as their indices
+ * may be reused for other sprites.
+ */
+void viewport_clear_sprite_coverage_masks();
 
 InteractionInfo set_interaction_info_from_paint_session(paint_session* session, uint16_t filter);
 InteractionInfo ViewportInteractionGetItemLeft(const ScreenCoordsXY& screenCoords);
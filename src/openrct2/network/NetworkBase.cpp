@@ -19,6 +19,7 @@
 #include "../actions/PeepPickupAction.h"
 #include "../core/Guard.hpp"
 #include "../core/Json.hpp"
+#include "../core/Trace.h"
 #include "../platform/Platform2.h"
 #include "../scripting/ScriptEngine.h"
 #include "../ui/UiContext.h"
@@ -74,6 +75,7 @@ static constexpr uint32_t CHUNK_SIZE = 1024 * 63;
 #    include "NetworkConnection.h"
 #    include "NetworkGroup.h"
 #    include "NetworkKey.h"
+#    include "NetworkMetrics.h"
 #    include "NetworkPacket.h"
 #    include "NetworkPlayer.h"
 #    include "NetworkServerAdvertiser.h"
@@ -233,6 +235,7 @@ void NetworkBase::CloseConnection()
     {
         _listenSocket.reset();
         _advertiser.reset();
+        _metricsServer.reset();
     }
 
     mode = NETWORK_MODE_NONE;
@@ -403,6 +406,21 @@ bool NetworkBase::BeginServer(uint16_t port, const std::string& address)
     _serverState.gamestateSnapshotsEnabled = gConfigNetwork.desync_debugging;
     _advertiser = CreateServerAdvertiser(listening_port);
 
+    if (gConfigNetwork.metrics_port != 0)
+    {
+        try
+        {
+            _metricsServer = CreateMetricsServer(gConfigNetwork.metrics_address, gConfigNetwork.metrics_port);
+            Console::WriteLine(
+                "Serving metrics on http://%s:%d/metrics", gConfigNetwork.metrics_address.c_str(),
+                gConfigNetwork.metrics_port);
+        }
+        catch (const std::exception& ex)
+        {
+            Console::Error::WriteLine("Unable to serve metrics: %s", ex.what());
+        }
+    }
+
     game_load_scripts();
 
     return true;
@@ -487,6 +505,8 @@ void NetworkBase::Update()
 
 void NetworkBase::Flush()
 {
+    TRACE_SCOPE("NetworkSend");
+
     if (GetMode() == NETWORK_MODE_CLIENT)
     {
         _serverConnection->SendQueuedPackets();
@@ -530,6 +550,11 @@ void NetworkBase::UpdateServer()
         _advertiser->Update();
     }
 
+    if (_metricsServer != nullptr)
+    {
+        _metricsServer->Update(client_connection_list);
+    }
+
     std::unique_ptr<ITcpSocket> tcpSocket = _listenSocket->Accept();
     if (tcpSocket != nullptr)
     {
@@ -1329,12 +1354,19 @@ NetworkStats_t NetworkBase::GetStats() const
             {
                 stats.bytesReceived[n] += connection->Stats.bytesReceived[n];
                 stats.bytesSent[n] += connection->Stats.bytesSent[n];
+                stats.packetsReceived[n] += connection->Stats.packetsReceived[n];
+                stats.packetsSent[n] += connection->Stats.packetsSent[n];
             }
         }
     }
     return stats;
 }
 
+OpenRCT2::LogicTimings* NetworkBase::GetLogicTimings()
+{
+    return _metricsServer != nullptr ? _metricsServer->GetLogicTimings() : nullptr;
+}
+
 void NetworkBase::Server_Send_AUTH(NetworkConnection& connection)
 {
     uint8_t new_playerid = 0;
@@ -1653,6 +1685,8 @@ void NetworkBase::Server_Send_EVENT_PLAYER_DISCONNECTED(const char* playerName,
 
 bool NetworkBase::ProcessConnection(NetworkConnection& connection)
 {
+    TRACE_SCOPE("NetworkReceive");
+
     NetworkReadPacket packetStatus;
     do
     {
@@ -3955,6 +3989,11 @@ NetworkStats_t network_get_stats()
     return gNetwork.GetStats();
 }
 
+OpenRCT2::LogicTimings* network_get_logic_timings()
+{
+    return gNetwork.GetLogicTimings();
+}
+
 NetworkServerState_t network_get_server_state()
 {
     return gNetwork.GetServerState();
@@ -4226,6 +4265,10 @@ NetworkStats_t network_get_stats()
 {
     return NetworkStats_t{};
 }
+OpenRCT2::LogicTimings* network_get_logic_timings()
+{
+    return nullptr;
+}
 NetworkServerState_t network_get_server_state()
 {
     return NetworkServerState_t{};
@@ -3,6 +3,7 @@
 #include "../actions/GameAction.h"
 #include "NetworkConnection.h"
 #include "NetworkGroup.h"
+#include "NetworkMetrics.h"
 #include "NetworkPlayer.h"
 #include "NetworkServerAdvertiser.h"
 #include "NetworkTypes.h"
@@ -42,6 +43,7 @@ public: // Common
     void AppendChatLog(const std::string& s);
     void CloseChatLog();
     NetworkStats_t GetStats() const;
+    OpenRCT2::LogicTimings* GetLogicTimings();
     json_t GetServerInfoAsJson() const;
     bool ProcessConnection(NetworkConnection& connection);
     void CloseConnection();
@@ -188,6 +190,7 @@ private: // Server Data
     std::unordered_map<NetworkCommand, CommandHandler> server_command_handlers;
     std::unique_ptr<ITcpSocket> _listenSocket;
     std::unique_ptr<INetworkServerAdvertiser> _advertiser;
+    std::unique_ptr<INetworkMetricsServer> _metricsServer;
     std::list<std::unique_ptr<NetworkConnection>> client_connection_list;
     std::string _serverLogPath;
     std::string _serverLogFilenameFormat = "%Y%m%d-%H%M%S.txt";
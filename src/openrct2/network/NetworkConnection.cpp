@@ -239,11 +239,15 @@ void NetworkConnection::RecordPacketStats(const NetworkPacket& packet, bool send
     {
         Stats.bytesSent[EnumValue(trafficGroup)] += packetSize;
         Stats.bytesSent[EnumValue(NetworkStatisticsGroup::Total)] += packetSize;
+        Stats.packetsSent[EnumValue(trafficGroup)]++;
+        Stats.packetsSent[EnumValue(NetworkStatisticsGroup::Total)]++;
     }
     else
     {
         Stats.bytesReceived[EnumValue(trafficGroup)] += packetSize;
         Stats.bytesReceived[EnumValue(NetworkStatisticsGroup::Total)] += packetSize;
+        Stats.packetsReceived[EnumValue(trafficGroup)]++;
+        Stats.packetsReceived[EnumValue(NetworkStatisticsGroup::Total)]++;
     }
 }
 
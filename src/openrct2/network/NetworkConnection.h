@@ -54,6 +54,10 @@ public:
 
     bool IsValid() const;
     void SendQueuedPackets();
+    size_t GetQueuedPacketCount() const
+    {
+        return _outboundPackets.size();
+    }
     void ResetLastPacketTime();
     bool ReceivedPacketRecently();
 
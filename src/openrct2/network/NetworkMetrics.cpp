@@ -0,0 +1,387 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifndef DISABLE_NETWORK
+
+#    include "NetworkMetrics.h"
+
+#    include "../Game.h"
+#    include "../GameState.h"
+#    include "../actions/GameAction.h"
+#    include "../core/String.hpp"
+#    include "../platform/Platform2.h"
+#    include "../world/Entity.h"
+#    include "../world/EntityList.h"
+#    include "../world/Map.h"
+#    include "NetworkConnection.h"
+#    include "NetworkPlayer.h"
+#    include "Socket.h"
+
+#    include <array>
+#    include <chrono>
+#    include <iterator>
+#    include <vector>
+
+using namespace OpenRCT2;
+
+// Upper bounds in seconds, a tick has 25 ms before the game falls behind
+static constexpr double HistogramBuckets[] = { 0.0001, 0.00025, 0.0005, 0.001, 0.0025, 0.005, 0.01, 0.025, 0.05, 0.1 };
+
+// Requests that have not been answered after this long are dropped
+static constexpr uint32_t RequestTimeout = 5000;
+
+// Largest request header accepted, scrapers send a few hundred bytes
+static constexpr size_t MaxRequestSize = 8192;
+
+// Label values in the same order as EntityType
+static constexpr const char* EntityTypeNames[] = {
+    "vehicle",
+    "guest",
+    "staff",
+    "litter",
+    "steam_particle",
+    "money_effect",
+    "crashed_vehicle_particle",
+    "explosion_cloud",
+    "crash_splash",
+    "explosion_flare",
+    "jumping_fountain",
+    "balloon",
+    "duck",
+};
+static_assert(std::size(EntityTypeNames) == static_cast<size_t>(EntityType::Count));
+
+// Label values in the same order as NetworkStatisticsGroup
+static constexpr const char* StatisticsGroupNames[] = { "total", "base", "commands", "map_data" };
+static_assert(std::size(StatisticsGroupNames) == EnumValue(NetworkStatisticsGroup::Max));
+
+struct Histogram
+{
+    std::array<uint64_t, std::size(HistogramBuckets)> Buckets{};
+    uint64_t Count{};
+    double Sum{};
+
+    void Observe(double value)
+    {
+        for (size_t i = 0; i < Buckets.size(); i++)
+        {
+            if (value <= HistogramBuckets[i])
+            {
+                Buckets[i]++;
+                break;
+            }
+        }
+        Count++;
+        Sum += value;
+    }
+};
+
+struct MetricsRequest
+{
+    std::unique_ptr<ITcpSocket> Socket;
+    std::string Request;
+    std::string Response;
+    size_t BytesSent{};
+    uint32_t StartTime{};
+};
+
+static std::string EscapeLabelValue(const std::string& value)
+{
+    std::string result;
+    result.reserve(value.size());
+    for (auto c : value)
+    {
+        switch (c)
+        {
+            case '\\':
+                result += "\\\\";
+                break;
+            case '"':
+                result += "\\\"";
+                break;
+            case '\n':
+                result += "\\n";
+                break;
+            default:
+                result += c;
+                break;
+        }
+    }
+    return result;
+}
+
+class NetworkMetricsServer final : public INetworkMetricsServer
+{
+private:
+    std::unique_ptr<ITcpSocket> _listenSocket;
+    std::vector<MetricsRequest> _requests;
+
+    LogicTimings _timings;
+    size_t _processedIdx{};
+    Histogram _tickHistogram;
+    std::array<Histogram, LOGIC_TIME_PART_COUNT> _partHistograms;
+
+public:
+    NetworkMetricsServer(const std::string& address, uint16_t port)
+    {
+        // Create every entry up front so reporting a tick does not allocate
+        for (size_t i = 0; i < LOGIC_TIME_PART_COUNT; i++)
+        {
+            _timings.TimingInfo[static_cast<LogicTimePart>(i)] = {};
+        }
+
+        _listenSocket = CreateTcpSocket();
+        _listenSocket->Listen(address, port);
+    }
+
+    LogicTimings* GetLogicTimings() override
+    {
+        return &_timings;
+    }
+
+    void Update(const std::list<std::unique_ptr<NetworkConnection>>& clients) override
+    {
+        RecordTicks();
+
+        auto socket = _listenSocket->Accept();
+        if (socket != nullptr)
+        {
+            MetricsRequest request;
+            request.Socket = std::move(socket);
+            request.StartTime = Platform::GetTicks();
+            _requests.push_back(std::move(request));
+        }
+
+        auto now = Platform::GetTicks();
+        for (auto it = _requests.begin(); it != _requests.end();)
+        {
+            if (UpdateRequest(*it, clients) || now - it->StartTime > RequestTimeout)
+            {
+                it = _requests.erase(it);
+            }
+            else
+            {
+                it++;
+            }
+        }
+    }
+
+private:
+    void RecordTicks()
+    {
+        // The logic update reports every part as the time since the start of the tick and moves on to the next entry
+        // once the tick is done, so every entry up to the current one is a finished tick
+        while (_processedIdx != _timings.CurrentIdx)
+        {
+            std::chrono::duration<double> previous{};
+            for (size_t i = 0; i < LOGIC_TIME_PART_COUNT; i++)
+            {
+                auto& reported = _timings.TimingInfo[static_cast<LogicTimePart>(i)][_processedIdx];
+                if (reported.count() > 0)
+                {
+                    _partHistograms[i].Observe((reported - previous).count());
+                    previous = reported;
+                    reported = {};
+                }
+            }
+            if (previous.count() > 0)
+            {
+                _tickHistogram.Observe(previous.count());
+            }
+            _processedIdx = (_processedIdx + 1) % LOGIC_UPDATE_MEASUREMENTS_COUNT;
+        }
+    }
+
+    /**
+     * Returns true once the request is done with, either answered or failed.
+     */
+    bool UpdateRequest(MetricsRequest& request, const std::list<std::unique_ptr<NetworkConnection>>& clients)
+    {
+        try
+        {
+            if (request.Response.empty())
+            {
+                char buffer[1024];
+                size_t bytesRead{};
+                auto status = request.Socket->ReceiveData(buffer, sizeof(buffer), &bytesRead);
+                if (status == NetworkReadPacket::Disconnected)
+                {
+                    return true;
+                }
+                if (status != NetworkReadPacket::Success)
+                {
+                    return false;
+                }
+
+                request.Request.append(buffer, bytesRead);
+                if (request.Request.find("\r\n\r\n") == std::string::npos)
+                {
+                    return request.Request.size() > MaxRequestSize;
+                }
+                request.Response = CreateResponse(request.Request, clients);
+            }
+
+            request.BytesSent += request.Socket->SendData(
+                request.Response.data() + request.BytesSent, request.Response.size() - request.BytesSent);
+            if (request.BytesSent < request.Response.size())
+            {
+                return false;
+            }
+            request.Socket->Finish();
+            return true;
+        }
+        catch (const std::exception& e)
+        {
+            log_verbose("Metrics request failed: %s", e.what());
+            return true;
+        }
+    }
+
+    std::string CreateResponse(const std::string& request, const std::list<std::unique_ptr<NetworkConnection>>& clients)
+    {
+        if (!String::StartsWith(request, "GET /metrics ") && !String::StartsWith(request, "GET / "))
+        {
+            return "HTTP/1.0 404 Not Found\r\nContent-Length: 0\r\nConnection: close\r\n\r\n";
+        }
+
+        auto body = CreateMetrics(clients);
+        return String::StdFormat(
+                   "HTTP/1.0 200 OK\r\n"
+                   "Content-Type: text/plain; version=0.0.4\r\n"
+                   "Content-Length: %zu\r\n"
+                   "Connection: close\r\n\r\n",
+                   body.size())
+            + body;
+    }
+
+    std::string CreateMetrics(const std::list<std::unique_ptr<NetworkConnection>>& clients) const
+    {
+        std::string result;
+
+        result += "# HELP openrct2_tick_duration_seconds Time spent updating the game logic for one tick.\n";
+        result += "# TYPE openrct2_tick_duration_seconds histogram\n";
+        AppendHistogram(result, "openrct2_tick_duration_seconds", "", _tickHistogram);
+
+        result += "# HELP openrct2_tick_part_duration_seconds Time spent in each part of the game logic for one tick.\n";
+        result += "# TYPE openrct2_tick_part_duration_seconds histogram\n";
+        for (size_t i = 0; i < LOGIC_TIME_PART_COUNT; i++)
+        {
+            auto labels = String::StdFormat("part=\"%s\"", GetLogicTimePartName(static_cast<LogicTimePart>(i)));
+            AppendHistogram(result, "openrct2_tick_part_duration_seconds", labels, _partHistograms[i]);
+        }
+
+        result += "# HELP openrct2_current_tick Number of ticks the park has been running for.\n";
+        result += "# TYPE openrct2_current_tick counter\n";
+        result += String::StdFormat("openrct2_current_tick %u\n", gCurrentTicks);
+
+        result += "# HELP openrct2_entities Number of entities of each type.\n";
+        result += "# TYPE openrct2_entities gauge\n";
+        for (size_t i = 0; i < std::size(EntityTypeNames); i++)
+        {
+            result += String::StdFormat(
+                "openrct2_entities{type=\"%s\"} %u\n", EntityTypeNames[i], GetEntityListCount(static_cast<EntityType>(i)));
+        }
+        result += "# HELP openrct2_entities_max Number of entities the park can hold.\n";
+        result += "# TYPE openrct2_entities_max gauge\n";
+        result += String::StdFormat("openrct2_entities_max %u\n", MAX_ENTITIES);
+
+        result += "# HELP openrct2_tile_elements Number of tile elements in use.\n";
+        result += "# TYPE openrct2_tile_elements gauge\n";
+        result += String::StdFormat("openrct2_tile_elements %u\n", map_get_num_tile_elements());
+        result += "# HELP openrct2_tile_elements_max Number of tile elements the map can hold.\n";
+        result += "# TYPE openrct2_tile_elements_max gauge\n";
+        result += String::StdFormat("openrct2_tile_elements_max %u\n", MAX_TILE_ELEMENTS);
+
+        result += "# HELP openrct2_game_action_queue_size Number of game actions waiting to be executed.\n";
+        result += "# TYPE openrct2_game_action_queue_size gauge\n";
+        result += String::StdFormat("openrct2_game_action_queue_size %zu\n", GameActions::GetQueueSize());
+
+        result += "# HELP openrct2_clients Number of connected clients.\n";
+        result += "# TYPE openrct2_clients gauge\n";
+        result += String::StdFormat("openrct2_clients %zu\n", clients.size());
+
+        AppendClientCounters(
+            result, clients, "openrct2_client_received_bytes_total", "Bytes received from each client.",
+            &NetworkStats_t::bytesReceived);
+        AppendClientCounters(
+            result, clients, "openrct2_client_sent_bytes_total", "Bytes sent to each client.", &NetworkStats_t::bytesSent);
+        AppendClientCounters(
+            result, clients, "openrct2_client_received_packets_total", "Packets received from each client.",
+            &NetworkStats_t::packetsReceived);
+        AppendClientCounters(
+            result, clients, "openrct2_client_sent_packets_total", "Packets sent to each client.",
+            &NetworkStats_t::packetsSent);
+
+        result += "# HELP openrct2_client_queued_packets Number of packets waiting to be sent to each client.\n";
+        result += "# TYPE openrct2_client_queued_packets gauge\n";
+        for (const auto& client : clients)
+        {
+            result += String::StdFormat(
+                "openrct2_client_queued_packets{%s} %zu\n", GetClientLabels(*client).c_str(), client->GetQueuedPacketCount());
+        }
+        return result;
+    }
+
+    static void AppendHistogram(std::string& result, const char* name, const std::string& labels, const Histogram& histogram)
+    {
+        auto separator = labels.empty() ? "" : ",";
+        uint64_t count = 0;
+        for (size_t i = 0; i < std::size(HistogramBuckets); i++)
+        {
+            count += histogram.Buckets[i];
+            result += String::StdFormat(
+                "%s_bucket{%s%sle=\"%g\"} %llu\n", name, labels.c_str(), separator, HistogramBuckets[i],
+                static_cast<unsigned long long>(count));
+        }
+        result += String::StdFormat(
+            "%s_bucket{%s%sle=\"+Inf\"} %llu\n", name, labels.c_str(), separator,
+            static_cast<unsigned long long>(histogram.Count));
+
+        auto braceOpen = labels.empty() ? "" : "{";
+        auto braceClose = labels.empty() ? "" : "}";
+        result += String::StdFormat("%s_sum%s%s%s %.9f\n", name, braceOpen, labels.c_str(), braceClose, histogram.Sum);
+        result += String::StdFormat(
+            "%s_count%s%s%s %llu\n", name, braceOpen, labels.c_str(), braceClose,
+            static_cast<unsigned long long>(histogram.Count));
+    }
+
+    static void AppendClientCounters(
+        std::string& result, const std::list<std::unique_ptr<NetworkConnection>>& clients, const char* name,
+        const char* help, const uint64_t (NetworkStats_t::*counters)[EnumValue(NetworkStatisticsGroup::Max)])
+    {
+        result += String::StdFormat("# HELP %s %s\n", name, help);
+        result += String::StdFormat("# TYPE %s counter\n", name);
+        for (const auto& client : clients)
+        {
+            auto labels = GetClientLabels(*client);
+            const auto& values = client->Stats.*counters;
+            for (size_t i = 0; i < std::size(StatisticsGroupNames); i++)
+            {
+                result += String::StdFormat(
+                    "%s{%s,group=\"%s\"} %llu\n", name, labels.c_str(), StatisticsGroupNames[i],
+                    static_cast<unsigned long long>(values[i]));
+            }
+        }
+    }
+
+    static std::string GetClientLabels(const NetworkConnection& client)
+    {
+        std::string playerName = client.Player != nullptr ? client.Player->Name : "";
+        std::string address = client.Socket != nullptr ? client.Socket->GetIpAddress() : "";
+        return String::StdFormat(
+            "player=\"%s\",address=\"%s\"", EscapeLabelValue(playerName).c_str(), EscapeLabelValue(address).c_str());
+    }
+};
+
+std::unique_ptr<INetworkMetricsServer> CreateMetricsServer(const std::string& address, uint16_t port)
+{
+    return std::make_unique<NetworkMetricsServer>(address, port);
+}
+
+#endif // DISABLE_NETWORK
@@ -0,0 +1,46 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+
+#include <list>
+#include <memory>
+#include <string>
+
+class NetworkConnection;
+
+namespace OpenRCT2
+{
+    struct LogicTimings;
+}
+
+/*
+ * Serves the health of a running server over plain HTTP in the Prometheus text format, so it can be scraped by
+ * monitoring. Enabled by setting metrics_port in the network section of the config, only localhost is listened on
+ * unless metrics_address says otherwise. Requests are answered from the game thread while the server updates, so a
+ * scrape never sees a half updated park.
+ */
+struct INetworkMetricsServer
+{
+    virtual ~INetworkMetricsServer() = default;
+
+    /**
+     * The timings the logic update should report into, every tick reported is added to the tick histograms.
+     */
+    virtual OpenRCT2::LogicTimings* GetLogicTimings() abstract;
+
+    virtual void Update(const std::list<std::unique_ptr<NetworkConnection>>& clients) abstract;
+};
+
+/**
+ * Starts listening on the given address and port, throws if the port can not be listened on.
+ */
+std::unique_ptr<INetworkMetricsServer> CreateMetricsServer(const std::string& address, uint16_t port);
@@ -145,4 +145,6 @@ struct NetworkStats_t
 {
     uint64_t bytesReceived[EnumValue(NetworkStatisticsGroup::Max)];
     uint64_t bytesSent[EnumValue(NetworkStatisticsGroup::Max)];
+    uint64_t packetsReceived[EnumValue(NetworkStatisticsGroup::Max)];
+    uint64_t packetsSent[EnumValue(NetworkStatisticsGroup::Max)];
 };
@@ -38,6 +38,7 @@ enum class NetworkPermission : uint32_t;
 namespace OpenRCT2
 {
     struct IPlatformEnvironment;
+    struct LogicTimings;
 }
 
 void network_set_env(const std::shared_ptr<OpenRCT2::IPlatformEnvironment>& env);
@@ -120,5 +121,7 @@ const utf8* network_get_server_provider_website();
 std::string network_get_version();
 
 NetworkStats_t network_get_stats();
+// The timings the logic update should report into while the server is serving metrics, otherwise nullptr
+OpenRCT2::LogicTimings* network_get_logic_timings();
 NetworkServerState_t network_get_server_state();
 json_t network_get_server_info_as_json();
@@ -23,6 +23,7 @@
 #include "../core/MemoryStream.h"
 #include "../core/Path.hpp"
 #include "../core/String.hpp"
+#include "../core/Trace.h"
 #include "../localisation/Localisation.h"
 #include "../localisation/LocalisationService.h"
 #include "../object/Object.h"
@@ -249,6 +250,7 @@ public:
 
     std::unique_ptr<Object> LoadObject(const ObjectRepositoryItem* ori) override
     {
+        TRACE_SCOPE("LoadObject");
         Guard::ArgumentNotNull(ori, GUARD_LINE);
 
         auto extension = Path::GetExtension(ori->Path);
@@ -23,6 +23,7 @@
 #include <algorithm>
 #include <array>
 #include <atomic>
+#include <chrono>
 
 using namespace OpenRCT2;
 
@@ -987,12 +988,17 @@ PaintEntryPool::Chain::~Chain()
 
 PaintEntryPool::Chain& PaintEntryPool::Chain::operator=(Chain&& chain) noexcept
 {
-    Pool = chain.Pool;
-    Head = chain.Head;
-    Current = chain.Current;
-    chain.Pool = nullptr;
-    chain.Head = nullptr;
-    chain.Current = nullptr;
+    if (this != &chain)
+    {
+        // Return any nodes kept from earlier use before taking over the other chain
+        Clear();
+        Pool = chain.Pool;
+        Head = chain.Head;
+        Current = chain.Current;
+        chain.Pool = nullptr;
+        chain.Head = nullptr;
+        chain.Current = nullptr;
+    }
     return *this;
 }
 
@@ -1016,12 +1022,15 @@ paint_entry* PaintEntryPool::Chain::Allocate()
     }
     else if (Current->Count >= NodeSize)
     {
-        // We need another node
-        Current->Next = Pool->AllocateNode();
+        // We need another node, use one kept from an earlier frame if there is one
         if (Current->Next == nullptr)
         {
-            // Unable to allocate any more nodes
-            return nullptr;
+            Current->Next = Pool->AllocateNode();
+            if (Current->Next == nullptr)
+            {
+                // Unable to allocate any more nodes
+                return nullptr;
+            }
         }
         Current = Current->Next;
     }
@@ -1042,6 +1051,23 @@ void PaintEntryPool::Chain::Clear()
     assert(Current == nullptr);
 }
 
+void PaintEntryPool::Chain::Reset()
+{
+    if (Pool == nullptr || Current == nullptr)
+    {
+        return;
+    }
+
+    // Keep as many nodes as were used this time, the next frame of the same column will want about as many again
+    Pool->FreeNodes(Current->Next);
+    Current->Next = nullptr;
+    for (auto* node = Head; node != nullptr; node = node->Next)
+    {
+        node->Count = 0;
+    }
+    Current = Head;
+}
+
 size_t PaintEntryPool::Chain::GetCount() const
 {
     size_t count = 0;
@@ -1063,9 +1089,25 @@ PaintEntryPool::~PaintEntryPool()
     _available.clear();
 }
 
+std::unique_lock<std::mutex> PaintEntryPool::Lock()
+{
+    std::unique_lock<std::mutex> lock(_mutex, std::try_to_lock);
+    if (!lock.owns_lock())
+    {
+        // Only time the lock when it is contended, the clock is not free either
+        auto waitStart = std::chrono::steady_clock::now();
+        lock.lock();
+        auto waited = std::chrono::steady_clock::now() - waitStart;
+        _lockWaitNanoseconds += std::chrono::duration_cast<std::chrono::nanoseconds>(waited).count();
+    }
+    return lock;
+}
+
 PaintEntryPool::Node* PaintEntryPool::AllocateNode()
 {
-    std::lock_guard<std::mutex> lock(_mutex);
+    _nodesAllocated++;
+
+    auto lock = Lock();
 
     PaintEntryPool::Node* result;
     if (_available.size() > 0)
@@ -1087,7 +1129,12 @@ PaintEntryPool::Chain PaintEntryPool::Create()
 
 void PaintEntryPool::FreeNodes(PaintEntryPool::Node* head)
 {
-    std::lock_guard<std::mutex> lock(_mutex);
+    if (head == nullptr)
+    {
+        return;
+    }
+
+    auto lock = Lock();
 
     auto node = head;
     while (node != nullptr)
@@ -1099,3 +1146,11 @@ void PaintEntryPool::FreeNodes(PaintEntryPool::Node* head)
         node = next;
     }
 }
+
+PaintEntryPool::Stats PaintEntryPool::TakeStats()
+{
+    Stats stats;
+    stats.NodesAllocated = _nodesAllocated.exchange(0);
+    stats.LockWaitMicroseconds = _lockWaitNanoseconds.exchange(0) / 1000;
+    return stats;
+}
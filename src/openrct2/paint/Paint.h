@@ -15,6 +15,7 @@
 #include "../interface/Colour.h"
 #include "../world/Location.hpp"
 
+#include <atomic>
 #include <mutex>
 #include <thread>
 
@@ -143,7 +144,8 @@ struct tunnel_entry
  * The internal implementation uses an unrolled linked list so that each
  * paint session can quickly allocate a new paint entry until it requires
  * another node / block of paint entries. Only the node allocation needs to
- * be thread safe.
+ * be thread safe. Sessions keep the nodes they used between frames, so the
+ * shared pool is usually only visited when a column needs more than before.
  */
 class PaintEntryPool
 {
@@ -172,20 +174,35 @@ public:
 
         paint_entry* Allocate();
         void Clear();
+        void Reset();
         size_t GetCount() const;
     };
 
+    struct Stats
+    {
+        size_t NodesAllocated{};
+        uint64_t LockWaitMicroseconds{};
+    };
+
 private:
     std::vector<Node*> _available;
     std::mutex _mutex;
+    std::atomic<size_t> _nodesAllocated{};
+    std::atomic<uint64_t> _lockWaitNanoseconds{};
 
     Node* AllocateNode();
+    std::unique_lock<std::mutex> Lock();
 
 public:
     ~PaintEntryPool();
 
     Chain Create();
     void FreeNodes(Node* head);
+
+    /**
+     * Returns the number of nodes handed out and the time spent waiting for the pool since the last call.
+     */
+    Stats TakeStats();
 };
 
 struct PaintSessionCore
@@ -14,10 +14,12 @@
 #include "../OpenRCT2.h"
 #include "../ReplayManager.h"
 #include "../config/Config.h"
+#include "../core/Trace.h"
 #include "../drawing/Drawing.h"
 #include "../drawing/IDrawingEngine.h"
 #include "../interface/Chat.h"
 #include "../interface/InteractiveConsole.h"
+#include "../interface/Viewport.h"
 #include "../localisation/FormatCodes.h"
 #include "../localisation/Formatting.h"
 #include "../localisation/Language.h"
@@ -25,6 +27,8 @@
 #include "../title/TitleScreen.h"
 #include "../ui/UiContext.h"
 
+#include <algorithm>
+
 using namespace OpenRCT2;
 using namespace OpenRCT2::Drawing;
 using namespace OpenRCT2::Paint;
@@ -35,8 +39,16 @@ Painter::Painter(const std::shared_ptr<IUiContext>& uiContext)
 {
 }
 
+Painter::~Painter()
+{
+    // The hit-test cache may still point at one of our sessions
+    viewport_release_interaction_cache();
+}
+
 void Painter::Paint(IDrawingEngine& de)
 {
+    TRACE_SCOPE("Paint");
+
     auto dpi = de.GetDrawingPixelInfo();
     if (gIntroState != IntroState::None)
     {
@@ -60,6 +72,8 @@ void Painter::Paint(IDrawingEngine& de)
         de.PaintWeather();
     }
 
+    _lastPaintStats = _paintStructPool.TakeStats();
+
     auto* replayManager = GetContext()->GetReplayManager();
     const char* text = nullptr;
 
@@ -113,6 +127,28 @@ void Painter::PaintFPS(rct_drawpixelinfo* dpi)
 
     // Make area dirty so the text doesn't get drawn over the last
     gfx_set_dirty_blocks({ { screenCoords - ScreenCoordsXY{ 16, 4 } }, { dpi->lastStringPos.x + 16, 16 } });
+
+    if (gConfigGeneral.multithreading)
+    {
+        PaintPoolStats(dpi, screenCoords.y + 12);
+    }
+}
+
+void Painter::PaintPoolStats(rct_drawpixelinfo* dpi, int32_t y)
+{
+    ScreenCoordsXY screenCoords(_uiContext->GetWidth() / 2, y);
+
+    // Nodes taken from the shared paint entry pool and time spent waiting for its lock during the last frame
+    char buffer[64]{};
+    FormatStringToBuffer(
+        buffer, sizeof(buffer), "{OUTLINE}{WHITE}{INT32} nodes {INT32} us",
+        static_cast<int32_t>(_lastPaintStats.NodesAllocated), static_cast<int32_t>(_lastPaintStats.LockWaitMicroseconds));
+
+    int32_t stringWidth = gfx_get_string_width(buffer, FontSpriteBase::MEDIUM);
+    screenCoords.x = screenCoords.x - (stringWidth / 2);
+    gfx_draw_string(dpi, screenCoords, buffer);
+
+    gfx_set_dirty_blocks({ { screenCoords - ScreenCoordsXY{ 16, 4 } }, { dpi->lastStringPos.x + 16, y + 16 } });
 }
 
 void Painter::MeasureFPS()
@@ -132,18 +168,19 @@ paint_session* Painter::CreateSession(rct_drawpixelinfo* dpi, uint32_t viewFlags
 {
     paint_session* session = nullptr;
 
-    if (_freePaintSessions.empty() == false)
+    // Re-use the first free session, so the n-th session of a frame is the same one every frame whatever order the
+    // sessions were released in
+    auto it = std::find(_paintSessionInUse.begin(), _paintSessionInUse.end(), false);
+    if (it != _paintSessionInUse.end())
     {
-        // Re-use.
-        session = _freePaintSessions.back();
-
-        // Shrink by one.
-        _freePaintSessions.pop_back();
+        *it = true;
+        session = _paintSessionPool[it - _paintSessionInUse.begin()].get();
     }
     else
     {
         // Create new one in pool.
         _paintSessionPool.emplace_back(std::make_unique<paint_session>());
+        _paintSessionInUse.push_back(true);
         session = _paintSessionPool.back().get();
     }
 
@@ -151,7 +188,10 @@ paint_session* Painter::CreateSession(rct_drawpixelinfo* dpi, uint32_t viewFlags
     session->ViewFlags = viewFlags;
     session->QuadrantBackIndex = std::numeric_limits<uint32_t>::max();
     session->QuadrantFrontIndex = 0;
-    session->PaintEntryChain = _paintStructPool.Create();
+    if (session->PaintEntryChain.Pool == nullptr)
+    {
+        session->PaintEntryChain = _paintStructPool.Create();
+    }
 
     std::fill(std::begin(session->Quadrants), std::end(session->Quadrants), nullptr);
     session->LastPS = nullptr;
@@ -167,6 +207,13 @@ paint_session* Painter::CreateSession(rct_drawpixelinfo* dpi, uint32_t viewFlags
 
 void Painter::ReleaseSession(paint_session* session)
 {
-    session->PaintEntryChain.Clear();
-    _freePaintSessions.push_back(session);
+    // The session keeps its nodes, whichever thread paints it next can fill them without touching the shared pool
+    session->PaintEntryChain.Reset();
+    auto it = std::find_if(_paintSessionPool.begin(), _paintSessionPool.end(), [session](const auto& pooled) {
+        return pooled.get() == session;
+    });
+    if (it != _paintSessionPool.end())
+    {
+        _paintSessionInUse[it - _paintSessionPool.begin()] = false;
+    }
 }
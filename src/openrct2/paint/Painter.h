@@ -36,15 +36,19 @@ namespace OpenRCT2
         {
         private:
             std::shared_ptr<Ui::IUiContext> const _uiContext;
-            std::vector<std::unique_ptr<paint_session>> _paintSessionPool;
-            std::vector<paint_session*> _freePaintSessions;
+            // Declared before the sessions so that it outlives them, sessions give their nodes back when destroyed
             PaintEntryPool _paintStructPool;
+            std::vector<std::unique_ptr<paint_session>> _paintSessionPool;
+            // Parallel to _paintSessionPool
+            std::vector<bool> _paintSessionInUse;
+            PaintEntryPool::Stats _lastPaintStats;
             time_t _lastSecond = 0;
             int32_t _currentFPS = 0;
             int32_t _frames = 0;
 
         public:
             explicit Painter(const std::shared_ptr<Ui::IUiContext>& uiContext);
+            ~Painter();
             void Paint(Drawing::IDrawingEngine& de);
 
             paint_session* CreateSession(rct_drawpixelinfo* dpi, uint32_t viewFlags);
@@ -53,6 +57,7 @@ namespace OpenRCT2
         private:
             void PaintReplayNotice(rct_drawpixelinfo* dpi, const char* text);
             void PaintFPS(rct_drawpixelinfo* dpi);
+            void PaintPoolStats(rct_drawpixelinfo* dpi, int32_t y);
             void MeasureFPS();
         };
     } // namespace Paint
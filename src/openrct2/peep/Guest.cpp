@@ -43,6 +43,7 @@
 #include "../world/Sprite.h"
 #include "../world/Surface.h"
 #include "../world/TileElementsView.h"
+#include "GuestAggregates.h"
 #include "GuestPathfinding.h"
 #include "Peep.h"
 #include "Staff.h"
@@ -6843,6 +6844,7 @@ void Guest::InsertNewThought(PeepThoughtType thoughtType, uint8_t thoughtArgumen
     Thoughts[0].fresh_timeout = 0;
 
     WindowInvalidateFlags |= PEEP_INVALIDATE_PEEP_THOUGHTS;
+    GetGuestAggregator().Invalidate(sprite_index);
 }
 
 // clang-format off
@@ -0,0 +1,192 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "GuestAggregates.h"
+
+#include "../localisation/Formatter.h"
+#include "../world/Entity.h"
+#include "../world/EntityList.h"
+#include "../world/Sprite.h"
+#include "Peep.h"
+
+// Visit every entity slot roughly once every 256 updates, which matches how often the guest list used to rescan
+static constexpr uint16_t SweepPerUpdate = (MAX_ENTITIES + 255) / 256;
+
+static GuestAggregator _guestAggregator;
+
+GuestAggregator& GetGuestAggregator()
+{
+    return _guestAggregator;
+}
+
+GuestAggregateKey guest_aggregate_get_key(const Guest& guest, GuestAggregateType type)
+{
+    GuestAggregateKey result;
+    Formatter ft(result.args);
+    switch (type)
+    {
+        case GuestAggregateType::Actions:
+            guest.FormatActionTo(ft);
+            break;
+        case GuestAggregateType::Thoughts:
+        {
+            const auto& thought = guest.Thoughts[0];
+            if (thought.type != PeepThoughtType::None && thought.freshness <= 5)
+            {
+                peep_thought_set_format_args(&thought, ft);
+            }
+            break;
+        }
+        default:
+            break;
+    }
+    return result;
+}
+
+size_t GuestAggregator::KeyHash::operator()(const GuestAggregateKey& key) const
+{
+    // FNV-1a
+    size_t hash = 2166136261u;
+    for (auto b : key.args)
+    {
+        hash = (hash ^ b) * 16777619u;
+    }
+    return hash;
+}
+
+void GuestAggregator::Rebuild()
+{
+    Reset();
+    _active = true;
+    _guestGroups.resize(MAX_ENTITIES);
+    for (auto& groups : _guestGroups)
+    {
+        groups.fill(NoGroup);
+    }
+    _isDirty.resize(MAX_ENTITIES);
+
+    for (auto guest : EntityList<Guest>())
+    {
+        UpdateGuest(guest->sprite_index);
+    }
+}
+
+void GuestAggregator::Reset()
+{
+    for (auto& table : _tables)
+    {
+        table = {};
+    }
+    _guestGroups = {};
+    _dirtyGuests = {};
+    _isDirty = {};
+    _sweepPosition = 0;
+    _active = false;
+}
+
+void GuestAggregator::Invalidate(uint16_t spriteIndex)
+{
+    if (!_active || spriteIndex >= MAX_ENTITIES || _isDirty[spriteIndex])
+        return;
+
+    _isDirty[spriteIndex] = true;
+    _dirtyGuests.push_back(spriteIndex);
+}
+
+void GuestAggregator::Update()
+{
+    if (!_active)
+        return;
+
+    for (auto spriteIndex : _dirtyGuests)
+    {
+        _isDirty[spriteIndex] = false;
+        UpdateGuest(spriteIndex);
+    }
+    _dirtyGuests.clear();
+
+    for (uint16_t i = 0; i < SweepPerUpdate; i++)
+    {
+        UpdateGuest(_sweepPosition);
+        _sweepPosition = (_sweepPosition + 1) % MAX_ENTITIES;
+    }
+}
+
+const std::vector<GuestAggregateGroup>& GuestAggregator::GetGroups(GuestAggregateType type) const
+{
+    return _tables[EnumValue(type)].Groups;
+}
+
+uint32_t GuestAggregator::GetGroupIndex(uint16_t spriteIndex, GuestAggregateType type) const
+{
+    if (spriteIndex >= _guestGroups.size())
+        return NoGroup;
+    return _guestGroups[spriteIndex][EnumValue(type)];
+}
+
+void GuestAggregator::UpdateGuest(uint16_t spriteIndex)
+{
+    auto guest = GetEntity<Guest>(spriteIndex);
+    for (uint8_t i = 0; i < EnumValue(GuestAggregateType::Count); i++)
+    {
+        auto type = static_cast<GuestAggregateType>(i);
+        if (guest == nullptr || guest->OutsideOfPark)
+        {
+            SetGroup(spriteIndex, type, nullptr);
+        }
+        else
+        {
+            auto key = guest_aggregate_get_key(*guest, type);
+            SetGroup(spriteIndex, type, &key);
+        }
+    }
+}
+
+void GuestAggregator::SetGroup(uint16_t spriteIndex, GuestAggregateType type, const GuestAggregateKey* key)
+{
+    auto& table = _tables[EnumValue(type)];
+    auto& groupIndex = _guestGroups[spriteIndex][EnumValue(type)];
+    if (groupIndex != NoGroup)
+    {
+        auto& oldGroup = table.Groups[groupIndex];
+        if (key != nullptr && oldGroup.Key == *key)
+            return;
+
+        oldGroup.NumGuests--;
+        if (oldGroup.NumGuests == 0)
+        {
+            table.GroupIndex.erase(oldGroup.Key);
+            table.FreeGroups.push_back(groupIndex);
+        }
+        groupIndex = NoGroup;
+    }
+
+    if (key == nullptr)
+        return;
+
+    auto it = table.GroupIndex.find(*key);
+    if (it == table.GroupIndex.end())
+    {
+        uint32_t newIndex;
+        if (table.FreeGroups.empty())
+        {
+            newIndex = static_cast<uint32_t>(table.Groups.size());
+            table.Groups.emplace_back();
+        }
+        else
+        {
+            newIndex = table.FreeGroups.back();
+            table.FreeGroups.pop_back();
+        }
+        table.Groups[newIndex].Key = *key;
+        it = table.GroupIndex.emplace(*key, newIndex).first;
+    }
+    groupIndex = it->second;
+    table.Groups[groupIndex].NumGuests++;
+}
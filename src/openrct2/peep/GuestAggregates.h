@@ -0,0 +1,133 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+#include "../util/Util.h"
+
+#include <array>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+struct Guest;
+
+enum class GuestAggregateType : uint8_t
+{
+    Actions,
+    Thoughts,
+    Count,
+};
+
+/**
+ * The formatted arguments of a guest's action or thought, guests with equal keys are grouped together.
+ */
+struct GuestAggregateKey
+{
+    uint8_t args[12]{};
+
+    rct_string_id GetFirstStringId() const
+    {
+        rct_string_id firstStrId{};
+        std::memcpy(&firstStrId, args, sizeof(firstStrId));
+        return firstStrId;
+    }
+
+    bool operator==(const GuestAggregateKey& other) const
+    {
+        return std::memcmp(args, other.args, sizeof(args)) == 0;
+    }
+    bool operator!=(const GuestAggregateKey& other) const
+    {
+        return !(*this == other);
+    }
+};
+
+struct GuestAggregateGroup
+{
+    GuestAggregateKey Key;
+    uint32_t NumGuests{};
+};
+
+GuestAggregateKey guest_aggregate_get_key(const Guest& guest, GuestAggregateType type);
+
+/**
+ * Maintains the number of guests in the park per action and per thought. Rather than re-formatting every guest
+ * whenever the groups are needed, each guest's group is cached and only recalculated when the guest is invalidated
+ * or visited by a slow background sweep, which catches changes that are not explicitly invalidated.
+ */
+class GuestAggregator
+{
+public:
+    static constexpr uint32_t NoGroup = UINT32_MAX;
+
+private:
+    struct KeyHash
+    {
+        size_t operator()(const GuestAggregateKey& key) const;
+    };
+
+    struct Table
+    {
+        std::vector<GuestAggregateGroup> Groups;
+        std::vector<uint32_t> FreeGroups;
+        std::unordered_map<GuestAggregateKey, uint32_t, KeyHash> GroupIndex;
+    };
+
+    std::array<Table, EnumValue(GuestAggregateType::Count)> _tables;
+    std::vector<std::array<uint32_t, EnumValue(GuestAggregateType::Count)>> _guestGroups;
+    std::vector<uint16_t> _dirtyGuests;
+    std::vector<bool> _isDirty;
+    uint16_t _sweepPosition{};
+    bool _active{};
+
+public:
+    /**
+     * Starts tracking guests, calculating the group of every guest currently in the park.
+     */
+    void Rebuild();
+
+    /**
+     * Stops tracking guests and frees all memory.
+     */
+    void Reset();
+
+    bool IsActive() const
+    {
+        return _active;
+    }
+
+    /**
+     * Flags the guest's groups to be recalculated on the next update, used when the guest's state or thoughts change.
+     */
+    void Invalidate(uint16_t spriteIndex);
+
+    /**
+     * Recalculates the groups of invalidated guests and advances the background sweep.
+     */
+    void Update();
+
+    /**
+     * All groups of the given type in no particular order. Groups without any guests may be present and should be
+     * skipped.
+     */
+    const std::vector<GuestAggregateGroup>& GetGroups(GuestAggregateType type) const;
+
+    /**
+     * Index into GetGroups of the group the guest belongs to, or NoGroup.
+     */
+    uint32_t GetGroupIndex(uint16_t spriteIndex, GuestAggregateType type) const;
+
+private:
+    void UpdateGuest(uint16_t spriteIndex);
+    void SetGroup(uint16_t spriteIndex, GuestAggregateType type, const GuestAggregateKey* key);
+};
+
+GuestAggregator& GetGuestAggregator();
@@ -46,6 +46,7 @@
 #include "../world/SmallScenery.h"
 #include "../world/Sprite.h"
 #include "../world/Surface.h"
+#include "GuestAggregates.h"
 #include "GuestPathfinding.h"
 #include "Staff.h"
 
@@ -658,6 +659,7 @@ void peep_sprite_remove(Peep* peep)
 
         News::DisableNewsItems(News::ItemType::Peep, staff->sprite_index);
     }
+    GetGuestAggregator().Invalidate(peep->sprite_index);
     sprite_remove(peep);
 
     auto intent = Intent(wasGuest ? INTENT_ACTION_REFRESH_GUEST_LIST : INTENT_ACTION_REFRESH_STAFF_LIST);
@@ -830,6 +832,7 @@ void Peep::SetState(PeepState new_state)
     peep_decrement_num_riders(this);
     State = new_state;
     peep_window_state_update(this);
+    GetGuestAggregator().Invalidate(sprite_index);
 }
 
 /**
@@ -857,6 +860,7 @@ static void peep_update_thoughts(Guest* peep)
     // a holding zone. Before it becomes fresh.
     int32_t add_fresh = 1;
     int32_t fresh_thought = -1;
+    const auto oldFreshness = peep->Thoughts[0].freshness;
     for (int32_t i = 0; i < PEEP_MAX_THOUGHTS; i++)
     {
         if (peep->Thoughts[i].type == PeepThoughtType::None)
@@ -907,6 +911,12 @@ static void peep_update_thoughts(Guest* peep)
         peep->Thoughts[fresh_thought].freshness = 1;
         peep->WindowInvalidateFlags |= PEEP_INVALIDATE_PEEP_THOUGHTS;
     }
+
+    // The guest list only groups by the latest thought while it is fresh
+    if (peep->Thoughts[0].freshness != oldFreshness)
+    {
+        GetGuestAggregator().Invalidate(peep->sprite_index);
+    }
 }
 
 /**
@@ -1177,9 +1187,12 @@ void peep_update_crowd_noise()
     // Count the number of peeps visible
     auto visiblePeeps = 0;
 
-    for (auto peep : EntityList<Guest>())
+    const ScreenRect viewRect{ viewport->viewPos,
+                               viewport->viewPos + ScreenCoordsXY{ viewport->view_width, viewport->view_height } };
+    for (auto spriteIndex : GetEntityIndicesInScreenRect(EntityType::Guest, viewRect))
     {
-        if (peep->sprite_left == LOCATION_NULL)
+        auto* peep = GetEntity<Guest>(spriteIndex);
+        if (peep == nullptr || peep->sprite_left == LOCATION_NULL)
             continue;
         if (viewport->viewPos.x > peep->sprite_right)
             continue;
@@ -422,16 +422,32 @@ void staff_toggle_patrol_area(int32_t staffIndex, const CoordsXY& coords)
  */
 Direction Staff::HandymanDirectionToNearestLitter() const
 {
+    // Only litter within MAX_LITTER_DISTANCE on both axes can be picked, so only the grid cells covering that range
+    // need to be searched. Ties go to the lowest sprite index, as they would when walking the whole litter list.
     uint16_t nearestLitterDist = 0xFFFF;
     Litter* nearestLitter = nullptr;
-    for (auto litter : EntityList<Litter>())
+    const auto cellStartX = floor2(std::max(x - MAX_LITTER_DISTANCE, 0), LITTER_GRID_CELL_SIZE);
+    const auto cellStartY = floor2(std::max(y - MAX_LITTER_DISTANCE, 0), LITTER_GRID_CELL_SIZE);
+    for (int32_t cellY = cellStartY; cellY <= y + MAX_LITTER_DISTANCE; cellY += LITTER_GRID_CELL_SIZE)
     {
-        uint16_t distance = abs(litter->x - x) + abs(litter->y - y) + abs(litter->z - z) * 4;
-
-        if (distance < nearestLitterDist)
+        for (int32_t cellX = cellStartX; cellX <= x + MAX_LITTER_DISTANCE; cellX += LITTER_GRID_CELL_SIZE)
         {
-            nearestLitterDist = distance;
-            nearestLitter = litter;
+            for (auto litterIndex : GetLitterGridCell({ cellX, cellY }))
+            {
+                auto* litter = GetEntity<Litter>(litterIndex);
+                if (litter == nullptr)
+                    continue;
+
+                uint16_t distance = abs(litter->x - x) + abs(litter->y - y) + abs(litter->z - z) * 4;
+
+                if (distance < nearestLitterDist
+                    || (distance == nearestLitterDist && nearestLitter != nullptr
+                        && litter->sprite_index < nearestLitter->sprite_index))
+                {
+                    nearestLitterDist = distance;
+                    nearestLitter = litter;
+                }
+            }
         }
     }
 
@@ -21,6 +21,7 @@
 #    include <ctime>
 #    include <dirent.h>
 #    include <pwd.h>
+#    include <sys/resource.h>
 #    include <sys/stat.h>
 
 namespace Platform
@@ -109,6 +110,21 @@ namespace Platform
         return false;
     }
 
+    uint64_t GetPeakMemoryUsage()
+    {
+        rusage usage{};
+        if (getrusage(RUSAGE_SELF, &usage) != 0)
+        {
+            return 0;
+        }
+#    if defined(__APPLE__) && defined(__MACH__)
+        return static_cast<uint64_t>(usage.ru_maxrss);
+#    else
+        // Reported in kilobytes everywhere but macOS
+        return static_cast<uint64_t>(usage.ru_maxrss) * 1024;
+#    endif
+    }
+
     bool FindApp(const std::string& app, std::string* output)
     {
         return Execute(String::StdFormat("which %s 2> /dev/null", app.c_str()), output) == 0;
@@ -17,6 +17,7 @@
 
 #    include <datetimeapi.h>
 #    include <memory>
+#    include <psapi.h>
 #    include <shlobj.h>
 #    undef GetEnvironmentVariable
 
@@ -270,6 +271,18 @@ namespace Platform
         return false;
     }
 
+    uint64_t GetPeakMemoryUsage()
+    {
+#    if _WIN32_WINNT >= 0x0601
+        PROCESS_MEMORY_COUNTERS counters{};
+        if (K32GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+        {
+            return counters.PeakWorkingSetSize;
+        }
+#    endif
+        return 0;
+    }
+
     /**
      * Checks if the current version of Windows supports ANSI colour codes.
      * From Windows 10, build 10586 ANSI escape colour codes can be used on stdout.
@@ -45,6 +45,10 @@ namespace Platform
     rct2_date GetDateLocal();
     bool FindApp(const std::string& app, std::string* output);
     int32_t Execute(const std::string& command, std::string* output = nullptr);
+    /**
+     * The largest amount of physical memory the process has used so far in bytes, or 0 if it is not known.
+     */
+    uint64_t GetPeakMemoryUsage();
 
 #if defined(__unix__) || (defined(__APPLE__) && defined(__MACH__)) || defined(__FreeBSD__)
     std::string GetEnvironmentPath(const char* name);
@@ -178,16 +178,20 @@ public:
         return result;
     }
 
-    ParkLoadResult LoadFromStream(
-        IStream* stream, bool isScenario, [[maybe_unused]] bool skipObjectCheck, const utf8* path) override
+    ParkLoadResult LoadFromStream(IStream* stream, bool isScenario, bool skipObjectCheck, const utf8* path) override
     {
-        _s4 = *ReadAndDecodeS4(stream, isScenario);
+        ReadAndDecodeS4(stream, isScenario);
         _s4Path = path;
         _isScenario = isScenario;
         _gameVersion = sawyercoding_detect_rct1_version(_s4.game_version) & FILE_VERSION_MASK;
 
         // Only determine what objects we required to import this saved game
         InitialiseEntryMaps();
+        if (skipObjectCheck)
+        {
+            // Reading the details for the scenario index does not need the objects, so skip scanning the map for them
+            return ParkLoadResult({});
+        }
         CreateAvailableObjectMappings();
         return ParkLoadResult(GetRequiredObjects());
     }
@@ -307,30 +311,25 @@ public:
     }
 
 private:
-    std::unique_ptr<rct1_s4> ReadAndDecodeS4(IStream* stream, bool isScenario)
+    void ReadAndDecodeS4(IStream* stream, bool isScenario)
     {
-        auto s4 = std::make_unique<rct1_s4>();
         size_t dataSize = stream->GetLength() - stream->GetPosition();
         auto data = stream->ReadArray<uint8_t>(dataSize);
-        auto decodedData = std::make_unique<uint8_t[]>(sizeof(rct1_s4));
 
+        // Decode straight into the park structure, it is the size of the whole decoded file
         size_t decodedSize;
+        auto decodedData = reinterpret_cast<uint8_t*>(&_s4);
         int32_t fileType = sawyercoding_detect_file_type(data.get(), dataSize);
         if (isScenario && (fileType & FILE_VERSION_MASK) != FILE_VERSION_RCT1)
         {
-            decodedSize = sawyercoding_decode_sc4(data.get(), decodedData.get(), dataSize, sizeof(rct1_s4));
+            decodedSize = sawyercoding_decode_sc4(data.get(), decodedData, dataSize, sizeof(rct1_s4));
         }
         else
         {
-            decodedSize = sawyercoding_decode_sv4(data.get(), decodedData.get(), dataSize, sizeof(rct1_s4));
+            decodedSize = sawyercoding_decode_sv4(data.get(), decodedData, dataSize, sizeof(rct1_s4));
         }
 
-        if (decodedSize == sizeof(rct1_s4))
-        {
-            std::memcpy(s4.get(), decodedData.get(), sizeof(rct1_s4));
-            return s4;
-        }
-        else
+        if (decodedSize != sizeof(rct1_s4))
         {
             throw std::runtime_error("Unable to decode park.");
         }
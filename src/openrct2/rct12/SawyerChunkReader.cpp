@@ -11,6 +11,8 @@
 
 #include "../core/IStream.hpp"
 
+#include <algorithm>
+
 // malloc is very slow for large allocations in MSVC debug builds as it allocates
 // memory on a special debug heap and then initialises all the memory to 0xCC.
 #if defined(_WIN32) && defined(DEBUG)
@@ -146,23 +148,73 @@ std::shared_ptr<SawyerChunk> SawyerChunkReader::ReadChunkTrack()
 
 void SawyerChunkReader::ReadChunk(void* dst, size_t length)
 {
-    auto chunk = ReadChunk();
-    auto chunkData = static_cast<const uint8_t*>(chunk->GetData());
-    auto chunkLength = chunk->GetLength();
-    if (chunkLength > length)
-    {
-        std::memcpy(dst, chunkData, length);
-    }
-    else
+    uint64_t originalPosition = _stream->GetPosition();
+    try
     {
-        std::memcpy(dst, chunkData, chunkLength);
-        auto remainingLength = length - chunkLength;
-        if (remainingLength > 0)
+        auto header = _stream->ReadValue<sawyercoding_chunk_header>();
+        if (header.length >= MAX_UNCOMPRESSED_CHUNK_SIZE)
+            throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_CHUNK_SIZE);
+
+        size_t decodedLength;
+        switch (header.encoding)
         {
-            auto offset = static_cast<uint8_t*>(dst) + chunkLength;
-            std::fill_n(offset, remainingLength, 0x00);
+            case CHUNK_ENCODING_NONE:
+            case CHUNK_ENCODING_RLE:
+            case CHUNK_ENCODING_ROTATE:
+            {
+                std::unique_ptr<uint8_t[]> compressedData(new uint8_t[header.length]);
+                if (_stream->TryRead(compressedData.get(), header.length) != header.length)
+                {
+                    throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_CHUNK_SIZE);
+                }
+
+                // Decode straight into the destination and stop as soon as it is full, anything past it would be
+                // thrown away anyway
+                if (header.encoding == CHUNK_ENCODING_NONE)
+                {
+                    decodedLength = std::min<size_t>(header.length, length);
+                    std::memcpy(dst, compressedData.get(), decodedLength);
+                }
+                else if (header.encoding == CHUNK_ENCODING_RLE)
+                {
+                    decodedLength = DecodeChunkRLEPrefix(dst, length, compressedData.get(), header.length);
+                }
+                else
+                {
+                    decodedLength = DecodeChunkRotate(
+                        dst, length, compressedData.get(), std::min<size_t>(header.length, length));
+                }
+                break;
+            }
+            case CHUNK_ENCODING_RLECOMPRESSED:
+            {
+                // The repeat pass copies from earlier output, so it still needs the full intermediate buffer
+                _stream->SetPosition(originalPosition);
+                auto chunk = ReadChunk();
+                decodedLength = std::min(chunk->GetLength(), length);
+                std::memcpy(dst, chunk->GetData(), decodedLength);
+                break;
+            }
+            default:
+                throw SawyerChunkException(EXCEPTION_MSG_INVALID_CHUNK_ENCODING);
+        }
+
+        if (decodedLength == 0 && length != 0)
+        {
+            throw SawyerChunkException(EXCEPTION_MSG_ZERO_SIZED_CHUNK);
+        }
+        if (decodedLength < length)
+        {
+            auto offset = static_cast<uint8_t*>(dst) + decodedLength;
+            std::fill_n(offset, length - decodedLength, 0x00);
         }
     }
+    catch (const std::exception&)
+    {
+        // Rewind stream back to original position
+        _stream->SetPosition(originalPosition);
+        throw;
+    }
 }
 
 void SawyerChunkReader::FreeChunk(void* data)
@@ -255,6 +307,48 @@ size_t SawyerChunkReader::DecodeChunkRLE(void* dst, size_t dstCapacity, const vo
     return reinterpret_cast<uintptr_t>(dst8) - reinterpret_cast<uintptr_t>(dst);
 }
 
+size_t SawyerChunkReader::DecodeChunkRLEPrefix(void* dst, size_t dstCapacity, const void* src, size_t srcLength)
+{
+    auto src8 = static_cast<const uint8_t*>(src);
+    auto dst8 = static_cast<uint8_t*>(dst);
+    auto dstEnd = dst8 + dstCapacity;
+    for (size_t i = 0; i < srcLength && dst8 < dstEnd; i++)
+    {
+        uint8_t rleCodeByte = src8[i];
+        if (rleCodeByte & 128)
+        {
+            i++;
+            size_t count = 257 - rleCodeByte;
+
+            if (i >= srcLength)
+            {
+                throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_RLE);
+            }
+
+            count = std::min<size_t>(count, dstEnd - dst8);
+            std::fill_n(dst8, count, src8[i]);
+            dst8 += count;
+        }
+        else
+        {
+            if (i + 1 >= srcLength)
+            {
+                throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_RLE);
+            }
+            if (i + 1 + rleCodeByte + 1 > srcLength)
+            {
+                throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_RLE);
+            }
+
+            size_t count = std::min<size_t>(rleCodeByte + 1, dstEnd - dst8);
+            std::memcpy(dst8, src8 + i + 1, count);
+            dst8 += count;
+            i += rleCodeByte + 1;
+        }
+    }
+    return reinterpret_cast<uintptr_t>(dst8) - reinterpret_cast<uintptr_t>(dst);
+}
+
 size_t SawyerChunkReader::DecodeChunkRepeat(void* dst, size_t dstCapacity, const void* src, size_t srcLength)
 {
     auto src8 = static_cast<const uint8_t*>(src);
@@ -65,10 +65,10 @@ public:
     std::shared_ptr<SawyerChunk> ReadChunkTrack();
 
     /**
-     * Reads the next chunk from the stream and copies it directly to the
-     * destination buffer. If the chunk is larger than length, only length
-     * is copied. If the chunk is smaller than length, the remaining space
-     * is padded with zero.
+     * Reads the next chunk from the stream and decodes it directly to the
+     * destination buffer. If the chunk is larger than length, decoding stops
+     * once length bytes have been written. If the chunk is smaller than
+     * length, the remaining space is padded with zero.
      * @param dst The destination buffer.
      * @param length The size of the destination buffer.
      */
@@ -95,6 +95,7 @@ private:
     static size_t DecodeChunk(void* dst, size_t dstCapacity, const void* src, const sawyercoding_chunk_header& header);
     static size_t DecodeChunkRLERepeat(void* dst, size_t dstCapacity, const void* src, size_t srcLength);
     static size_t DecodeChunkRLE(void* dst, size_t dstCapacity, const void* src, size_t srcLength);
+    static size_t DecodeChunkRLEPrefix(void* dst, size_t dstCapacity, const void* src, size_t srcLength);
     static size_t DecodeChunkRepeat(void* dst, size_t dstCapacity, const void* src, size_t srcLength);
     static size_t DecodeChunkRotate(void* dst, size_t dstCapacity, const void* src, size_t srcLength);
 
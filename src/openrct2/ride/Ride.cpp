@@ -55,9 +55,12 @@
 #include "../world/Park.h"
 #include "../world/Scenery.h"
 #include "../world/Sprite.h"
+#include "../world/TileElementsView.h"
 #include "CableLift.h"
 #include "RideAudio.h"
 #include "RideData.h"
+#include "RideGeometryCache.h"
+#include "RideTileIndex.h"
 #include "ShopItem.h"
 #include "Station.h"
 #include "Track.h"
@@ -442,41 +445,45 @@ bool ride_try_get_origin_element(const Ride* ride, CoordsXYE* output)
 {
     TileElement* resultTileElement = nullptr;
 
-    tile_element_iterator it;
-    tile_element_iterator_begin(&it);
-    do
+    for (const auto& tilePos : ride_tile_index_get(ride->id))
     {
-        if (it.element->GetType() != TILE_ELEMENT_TYPE_TRACK)
-            continue;
-        if (it.element->AsTrack()->GetRideIndex() != ride->id)
+        auto* tileElement = map_get_first_element_at(tilePos.ToCoordsXY());
+        if (tileElement == nullptr)
             continue;
+        do
+        {
+            if (tileElement->GetType() != TILE_ELEMENT_TYPE_TRACK)
+                continue;
+            if (tileElement->AsTrack()->GetRideIndex() != ride->id)
+                continue;
 
-        // Found a track piece for target ride
-
-        // Check if it's not the station or ??? (but allow end piece of station)
-        bool specialTrackPiece
-            = (it.element->AsTrack()->GetTrackType() != TrackElemType::BeginStation
-               && it.element->AsTrack()->GetTrackType() != TrackElemType::MiddleStation
-               && (TrackSequenceProperties[it.element->AsTrack()->GetTrackType()][0] & TRACK_SEQUENCE_FLAG_ORIGIN));
+            // Found a track piece for target ride
 
-        // Set result tile to this track piece if first found track or a ???
-        if (resultTileElement == nullptr || specialTrackPiece)
-        {
-            resultTileElement = it.element;
+            // Check if it's not the station or ??? (but allow end piece of station)
+            bool specialTrackPiece
+                = (tileElement->AsTrack()->GetTrackType() != TrackElemType::BeginStation
+                   && tileElement->AsTrack()->GetTrackType() != TrackElemType::MiddleStation
+                   && (TrackSequenceProperties[tileElement->AsTrack()->GetTrackType()][0] & TRACK_SEQUENCE_FLAG_ORIGIN));
 
-            if (output != nullptr)
+            // Set result tile to this track piece if first found track or a ???
+            if (resultTileElement == nullptr || specialTrackPiece)
             {
-                output->element = resultTileElement;
-                output->x = it.x * COORDS_XY_STEP;
-                output->y = it.y * COORDS_XY_STEP;
+                resultTileElement = tileElement;
+
+                if (output != nullptr)
+                {
+                    output->element = resultTileElement;
+                    output->x = tilePos.x * COORDS_XY_STEP;
+                    output->y = tilePos.y * COORDS_XY_STEP;
+                }
             }
-        }
 
-        if (specialTrackPiece)
-        {
-            return true;
-        }
-    } while (tile_element_iterator_next(&it));
+            if (specialTrackPiece)
+            {
+                return true;
+            }
+        } while (!(tileElement++)->IsLastForTile());
+    }
 
     return resultTileElement != nullptr;
 }
@@ -1185,26 +1192,19 @@ void ride_remove_peeps(Ride* ride)
 
 void ride_clear_blocked_tiles(Ride* ride)
 {
-    for (int32_t y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL; y++)
+    for (const auto& tilePos : ride_tile_index_get(ride->id))
     {
-        for (int32_t x = 0; x < MAXIMUM_MAP_SIZE_TECHNICAL; x++)
+        for (auto* trackElement : TileElementsView<TrackElement>(tilePos.ToCoordsXY()))
         {
-            auto element = map_get_first_element_at(TileCoordsXY{ x, y }.ToCoordsXY());
-            if (element != nullptr)
+            if (trackElement->GetRideIndex() != ride->id)
+                continue;
+
+            // Unblock footpath element that is at same position
+            auto footpathElement = map_get_footpath_element(
+                TileCoordsXYZ{ tilePos, trackElement->base_height }.ToCoordsXYZ());
+            if (footpathElement != nullptr)
             {
-                do
-                {
-                    if (element->GetType() == TILE_ELEMENT_TYPE_TRACK && element->AsTrack()->GetRideIndex() == ride->id)
-                    {
-                        // Unblock footpath element that is at same position
-                        auto footpathElement = map_get_footpath_element(
-                            TileCoordsXYZ{ x, y, element->base_height }.ToCoordsXYZ());
-                        if (footpathElement != nullptr)
-                        {
-                            footpathElement->AsPath()->SetIsBlockedByVehicle(false);
-                        }
-                    }
-                } while (!(element++)->IsLastForTile());
+                footpathElement->AsPath()->SetIsBlockedByVehicle(false);
             }
         }
     }
@@ -2712,7 +2712,7 @@ Staff* ride_find_closest_mechanic(Ride* ride, int32_t forInspection)
 
     // Get station start track element and position
     auto mapLocation = location.ToCoordsXYZ();
-    TileElement* tileElement = ride_get_station_exit_element(mapLocation);
+    TileElement* tileElement = ride_geometry_cache_get_station_exit(*ride, stationIndex, mapLocation);
     if (tileElement == nullptr)
         return nullptr;
 
@@ -4809,25 +4809,7 @@ static void ride_scroll_to_track_error(CoordsXYE* trackElement)
  */
 TrackElement* Ride::GetOriginElement(StationIndex stationIndex) const
 {
-    auto stationLoc = stations[stationIndex].Start;
-    TileElement* tileElement = map_get_first_element_at(stationLoc);
-    if (tileElement == nullptr)
-        return nullptr;
-    do
-    {
-        if (tileElement->GetType() != TILE_ELEMENT_TYPE_TRACK)
-            continue;
-
-        auto* trackElement = tileElement->AsTrack();
-
-        if (!(TrackSequenceProperties[trackElement->GetTrackType()][0] & TRACK_SEQUENCE_FLAG_ORIGIN))
-            continue;
-
-        if (trackElement->GetRideIndex() == id)
-            return trackElement;
-    } while (!(tileElement++)->IsLastForTile());
-
-    return nullptr;
+    return ride_geometry_cache_get_origin(*this, stationIndex);
 }
 
 bool Ride::Test(int32_t newStatus, bool isApplying)
@@ -5598,19 +5580,17 @@ bool Ride::IsBlockSectioned() const
 
 bool ride_has_any_track_elements(const Ride* ride)
 {
-    tile_element_iterator it;
-
-    tile_element_iterator_begin(&it);
-    while (tile_element_iterator_next(&it))
+    for (const auto& tilePos : ride_tile_index_get(ride->id))
     {
-        if (it.element->GetType() != TILE_ELEMENT_TYPE_TRACK)
-            continue;
-        if (it.element->AsTrack()->GetRideIndex() != ride->id)
-            continue;
-        if (it.element->IsGhost())
-            continue;
+        for (auto* trackElement : TileElementsView<TrackElement>(tilePos.ToCoordsXY()))
+        {
+            if (trackElement->GetRideIndex() != ride->id)
+                continue;
+            if (trackElement->IsGhost())
+                continue;
 
-        return true;
+            return true;
+        }
     }
 
     return false;
@@ -7271,17 +7251,22 @@ void determine_ride_entrance_and_exit_locations()
 
 void ride_clear_leftover_entrances(Ride* ride)
 {
-    tile_element_iterator it;
-
-    tile_element_iterator_begin(&it);
-    while (tile_element_iterator_next(&it))
+    for (const auto& tilePos : ride_tile_index_get(ride->id))
     {
-        if (it.element->GetType() == TILE_ELEMENT_TYPE_ENTRANCE
-            && it.element->AsEntrance()->GetEntranceType() != ENTRANCE_TYPE_PARK_ENTRANCE
-            && it.element->AsEntrance()->GetRideIndex() == ride->id)
+        auto* tileElement = map_get_first_element_at(tilePos.ToCoordsXY());
+        while (tileElement != nullptr)
         {
-            tile_element_remove(it.element);
-            tile_element_iterator_restart_for_tile(&it);
+            if (tileElement->GetType() == TILE_ELEMENT_TYPE_ENTRANCE
+                && tileElement->AsEntrance()->GetEntranceType() != ENTRANCE_TYPE_PARK_ENTRANCE
+                && tileElement->AsEntrance()->GetRideIndex() == ride->id)
+            {
+                // Removing shifts the remaining elements down, so look at the tile again
+                tile_element_remove(tileElement);
+                tileElement = map_get_first_element_at(tilePos.ToCoordsXY());
+                continue;
+            }
+            if ((tileElement++)->IsLastForTile())
+                break;
         }
     }
 }
@@ -0,0 +1,151 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "RideGeometryCache.h"
+
+#include "../world/Map.h"
+#include "Ride.h"
+#include "Track.h"
+#include "TrackData.h"
+
+#include <array>
+#include <bitset>
+
+namespace
+{
+    enum class RideGeometryKind : uint8_t
+    {
+        StationStart,
+        Origin,
+        StationExit,
+        Count,
+    };
+
+    struct RideGeometryEntry
+    {
+        uint32_t Generation{};
+        CoordsXYZ Location;
+        int16_t Offset{};
+    };
+} // namespace
+
+static constexpr size_t NumRideGeometryKinds = static_cast<size_t>(RideGeometryKind::Count);
+
+static std::array<std::array<std::array<RideGeometryEntry, MAX_STATIONS>, NumRideGeometryKinds>, MAX_RIDES> _rideGeometry;
+
+// Entries start out with generation 0 so they are never valid before the first lookup
+static uint32_t _rideGeometryGeneration = 1;
+
+// Tiles that entries of the current generation point into, changes to any other tile leave the cache alone
+static std::bitset<MAXIMUM_MAP_SIZE_TECHNICAL * MAXIMUM_MAP_SIZE_TECHNICAL> _rideGeometryTiles;
+
+static size_t ride_geometry_cache_get_tile_index(const CoordsXY& loc)
+{
+    auto tileLoc = TileCoordsXY(loc);
+    return tileLoc.y * MAXIMUM_MAP_SIZE_TECHNICAL + tileLoc.x;
+}
+
+void ride_geometry_cache_invalidate()
+{
+    _rideGeometryGeneration++;
+    if (_rideGeometryGeneration == 0)
+    {
+        // Wrapped around, old entries could appear valid again
+        _rideGeometry = {};
+        _rideGeometryGeneration = 1;
+    }
+    _rideGeometryTiles.reset();
+}
+
+void ride_geometry_cache_invalidate_tile(const CoordsXY& loc)
+{
+    if (!map_is_location_valid(loc) || _rideGeometryTiles.test(ride_geometry_cache_get_tile_index(loc)))
+    {
+        ride_geometry_cache_invalidate();
+    }
+}
+
+template<typename TPredicate>
+static TileElement* ride_geometry_cache_find(
+    const Ride& ride, StationIndex stationIndex, RideGeometryKind kind, const CoordsXYZ& location, TPredicate predicate)
+{
+    auto* firstElement = map_get_first_element_at(location);
+    if (firstElement == nullptr)
+        return nullptr;
+
+    if (ride.id >= MAX_RIDES || stationIndex >= MAX_STATIONS)
+    {
+        auto* tileElement = firstElement;
+        do
+        {
+            if (predicate(tileElement))
+                return tileElement;
+        } while (!(tileElement++)->IsLastForTile());
+        return nullptr;
+    }
+
+    auto& entry = _rideGeometry[ride.id][static_cast<size_t>(kind)][stationIndex];
+    if (entry.Generation == _rideGeometryGeneration && entry.Location == location && entry.Offset >= 0)
+    {
+        // No element of the tile has been inserted, removed or moved since, so the offset still points into the tile
+        auto* tileElement = firstElement + entry.Offset;
+        if (predicate(tileElement))
+            return tileElement;
+    }
+
+    entry.Generation = _rideGeometryGeneration;
+    entry.Location = location;
+    entry.Offset = -1;
+
+    auto* tileElement = firstElement;
+    do
+    {
+        if (predicate(tileElement))
+        {
+            entry.Offset = static_cast<int16_t>(tileElement - firstElement);
+            _rideGeometryTiles.set(ride_geometry_cache_get_tile_index(location));
+            return tileElement;
+        }
+    } while (!(tileElement++)->IsLastForTile());
+    return nullptr;
+}
+
+TileElement* ride_geometry_cache_get_station_start(const Ride& ride, StationIndex stationIndex)
+{
+    auto stationStart = ride.stations[stationIndex].GetStart();
+    return ride_geometry_cache_find(
+        ride, stationIndex, RideGeometryKind::StationStart, stationStart, [&stationStart](const TileElement* tileElement) {
+            return tileElement->GetType() == TILE_ELEMENT_TYPE_TRACK && stationStart.z == tileElement->GetBaseZ();
+        });
+}
+
+TrackElement* ride_geometry_cache_get_origin(const Ride& ride, StationIndex stationIndex)
+{
+    // The origin search does not depend on the station height
+    auto stationLoc = CoordsXYZ{ ride.stations[stationIndex].Start, 0 };
+    auto rideIndex = ride.id;
+    auto* tileElement = ride_geometry_cache_find(
+        ride, stationIndex, RideGeometryKind::Origin, stationLoc, [rideIndex](const TileElement* element) {
+            if (element->GetType() != TILE_ELEMENT_TYPE_TRACK)
+                return false;
+
+            auto* trackElement = element->AsTrack();
+            return (TrackSequenceProperties[trackElement->GetTrackType()][0] & TRACK_SEQUENCE_FLAG_ORIGIN)
+                && trackElement->GetRideIndex() == rideIndex;
+        });
+    return tileElement != nullptr ? tileElement->AsTrack() : nullptr;
+}
+
+TileElement* ride_geometry_cache_get_station_exit(const Ride& ride, StationIndex stationIndex, const CoordsXYZ& exitPos)
+{
+    return ride_geometry_cache_find(
+        ride, stationIndex, RideGeometryKind::StationExit, exitPos, [&exitPos](const TileElement* tileElement) {
+            return tileElement->GetType() == TILE_ELEMENT_TYPE_ENTRANCE && exitPos.z == tileElement->GetBaseZ();
+        });
+}
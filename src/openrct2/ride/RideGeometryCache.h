@@ -0,0 +1,54 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+#include "../world/Location.hpp"
+#include "RideTypes.h"
+#include "Station.h"
+
+struct Ride;
+struct TileElement;
+struct TrackElement;
+
+/*
+ * The ride geometry cache remembers where the station start, origin and exit elements of every ride station sit within
+ * their tile, so the per tick ride and station updates do not have to search the tile for them again. Entries are stored
+ * as an offset from the first element of the tile rather than as a pointer, which keeps them valid while the element
+ * storage is compacted. Inserting, removing or reordering elements changes those offsets, so that is what invalidates
+ * the cache, but only when it happens on a tile the cache points into. A cached element is still checked against the
+ * search criteria before it is returned, falling back to a search of the tile if it no longer matches.
+ */
+
+/**
+ * Discards all cached lookups. Called whenever the map is replaced.
+ */
+void ride_geometry_cache_invalidate();
+
+/**
+ * Discards all cached lookups if any of them points into the given tile. Called whenever elements of the tile are
+ * inserted, removed or reordered.
+ */
+void ride_geometry_cache_invalidate_tile(const CoordsXY& loc);
+
+/**
+ * The track element at the start of the given station, the first track element on the tile at the station height.
+ */
+TileElement* ride_geometry_cache_get_station_start(const Ride& ride, StationIndex stationIndex);
+
+/**
+ * The track element of the given ride that has the origin flag on the station start tile.
+ */
+TrackElement* ride_geometry_cache_get_origin(const Ride& ride, StationIndex stationIndex);
+
+/**
+ * The first entrance element at the given exit or entrance location of the station.
+ */
+TileElement* ride_geometry_cache_get_station_exit(const Ride& ride, StationIndex stationIndex, const CoordsXYZ& exitPos);
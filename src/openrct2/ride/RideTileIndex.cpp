@@ -0,0 +1,118 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "RideTileIndex.h"
+
+#include "../world/Entrance.h"
+#include "../world/Map.h"
+#include "Ride.h"
+#include "Track.h"
+
+#include <algorithm>
+#include <array>
+
+static std::array<std::vector<TileCoordsXY>, MAX_RIDES> _rideTiles;
+static bool _rideTileIndexValid;
+
+static ride_id_t ride_tile_index_get_ride(const TileElement* tileElement)
+{
+    switch (tileElement->GetType())
+    {
+        case TILE_ELEMENT_TYPE_TRACK:
+            return tileElement->AsTrack()->GetRideIndex();
+        case TILE_ELEMENT_TYPE_ENTRANCE:
+            if (tileElement->AsEntrance()->GetEntranceType() != ENTRANCE_TYPE_PARK_ENTRANCE)
+                return tileElement->AsEntrance()->GetRideIndex();
+            break;
+    }
+    return RIDE_ID_NULL;
+}
+
+static bool ride_tile_index_is_before(const TileCoordsXY& a, const TileCoordsXY& b)
+{
+    return a.y != b.y ? a.y < b.y : a.x < b.x;
+}
+
+static void ride_tile_index_rebuild()
+{
+    for (auto& tiles : _rideTiles)
+    {
+        tiles.clear();
+    }
+
+    // Visiting tiles in iterator order keeps every list sorted
+    for (int32_t y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL; y++)
+    {
+        for (int32_t x = 0; x < MAXIMUM_MAP_SIZE_TECHNICAL; x++)
+        {
+            const TileCoordsXY tilePos{ x, y };
+            const auto* tileElement = map_get_first_element_at(tilePos.ToCoordsXY());
+            if (tileElement == nullptr)
+                continue;
+            do
+            {
+                auto rideIndex = ride_tile_index_get_ride(tileElement);
+                if (rideIndex < MAX_RIDES)
+                {
+                    auto& tiles = _rideTiles[rideIndex];
+                    if (tiles.empty() || tiles.back() != tilePos)
+                    {
+                        tiles.push_back(tilePos);
+                    }
+                }
+            } while (!(tileElement++)->IsLastForTile());
+        }
+    }
+    _rideTileIndexValid = true;
+}
+
+void ride_tile_index_invalidate()
+{
+    _rideTileIndexValid = false;
+}
+
+void ride_tile_index_add_element(const CoordsXY& loc, const TileElement* tileElement)
+{
+    // Anything placed now will be picked up by the rebuild
+    if (!_rideTileIndexValid)
+        return;
+
+    auto rideIndex = ride_tile_index_get_ride(tileElement);
+    if (rideIndex >= MAX_RIDES)
+        return;
+
+    auto& tiles = _rideTiles[rideIndex];
+    const TileCoordsXY tilePos{ loc };
+    auto it = std::lower_bound(tiles.begin(), tiles.end(), tilePos, ride_tile_index_is_before);
+    if (it == tiles.end() || *it != tilePos)
+    {
+        tiles.insert(it, tilePos);
+    }
+}
+
+void ride_tile_index_clear(ride_id_t rideIndex)
+{
+    if (rideIndex < MAX_RIDES)
+    {
+        _rideTiles[rideIndex].clear();
+    }
+}
+
+const std::vector<TileCoordsXY>& ride_tile_index_get(ride_id_t rideIndex)
+{
+    static const std::vector<TileCoordsXY> noTiles;
+    if (rideIndex >= MAX_RIDES)
+        return noTiles;
+
+    if (!_rideTileIndexValid)
+    {
+        ride_tile_index_rebuild();
+    }
+    return _rideTiles[rideIndex];
+}
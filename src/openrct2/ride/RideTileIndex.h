@@ -0,0 +1,46 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+#include "../world/Location.hpp"
+#include "RideTypes.h"
+
+#include <vector>
+
+struct TileElement;
+
+/*
+ * The ride tile index records which tiles hold track, entrance or exit elements of each ride so that a ride's elements
+ * can be found without scanning the whole map. A tile is not removed when the ride's elements on it are, so users must
+ * still check the ride index of every element on the returned tiles. Tiles are sorted in the order that
+ * tile_element_iterator visits them so results match a full map scan.
+ */
+
+/**
+ * Discards the index, it will be rebuilt from the map the next time it is used. Called whenever the map is replaced.
+ */
+void ride_tile_index_invalidate();
+
+/**
+ * Records that the element at the given location may belong to a ride. Must be called whenever a track, entrance or exit
+ * element is placed.
+ */
+void ride_tile_index_add_element(const CoordsXY& loc, const TileElement* tileElement);
+
+/**
+ * Forgets all tiles of a ride, only valid once all of its elements have been removed.
+ */
+void ride_tile_index_clear(ride_id_t rideIndex);
+
+/**
+ * All tiles that may contain elements of the given ride.
+ */
+const std::vector<TileCoordsXY>& ride_tile_index_get(ride_id_t rideIndex);
@@ -13,6 +13,7 @@
 #include "../peep/Peep.h"
 #include "../scenario/Scenario.h"
 #include "../world/Location.hpp"
+#include "RideGeometryCache.h"
 #include "Track.h"
 #include "Vehicle.h"
 
@@ -330,20 +331,7 @@ static void ride_invalidate_station_start(Ride* ride, StationIndex stationIndex,
 
 TileElement* ride_get_station_start_track_element(Ride* ride, StationIndex stationIndex)
 {
-    auto stationStart = ride->stations[stationIndex].GetStart();
-
-    // Find the station track element
-    TileElement* tileElement = map_get_first_element_at(stationStart);
-    if (tileElement == nullptr)
-        return nullptr;
-    do
-    {
-        if (tileElement->GetType() == TILE_ELEMENT_TYPE_TRACK && stationStart.z == tileElement->GetBaseZ())
-            return tileElement;
-
-    } while (!(tileElement++)->IsLastForTile());
-
-    return nullptr;
+    return ride_geometry_cache_get_station_start(*ride, stationIndex);
 }
 
 TileElement* ride_get_station_exit_element(const CoordsXYZ& elementPos)
@@ -51,9 +51,11 @@
 #include "../world/Scenery.h"
 #include "../world/SmallScenery.h"
 #include "../world/Surface.h"
+#include "../world/TileElementRegistry.h"
 #include "../world/Wall.h"
 #include "Ride.h"
 #include "RideData.h"
+#include "RideTileIndex.h"
 #include "Track.h"
 #include "TrackData.h"
 #include "TrackDesignRepository.h"
@@ -2124,6 +2126,9 @@ static void track_design_preview_restore_map(map_backup* backup)
     gMapSizeMinus2 = backup->map_size_units_minus_2;
     gMapSize = backup->map_size;
     gCurrentRotation = backup->current_rotation;
+    map_reset_element_allocator();
+    ride_tile_index_invalidate();
+    tile_element_registry_invalidate();
 }
 
 /**
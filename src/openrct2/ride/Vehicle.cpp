@@ -1297,9 +1297,22 @@ void vehicle_sounds_update()
 
     vehicle_sounds_update_window_setup();
 
-    for (auto vehicle : TrainManager::View())
+    // Only trains near the listening viewport can make a sound, see Vehicle::SoundCanPlay
+    if (g_music_tracking_viewport != nullptr)
     {
-        vehicle->UpdateSoundParams(vehicleSoundParamsList);
+        const auto* viewport = g_music_tracking_viewport;
+        const ScreenCoordsXY quarterSize{ viewport->view_width / 4, viewport->view_height / 4 };
+        const ScreenRect listenRect{ viewport->viewPos - quarterSize,
+                                     viewport->viewPos + ScreenCoordsXY{ viewport->view_width, viewport->view_height }
+                                         + quarterSize };
+        for (auto spriteIndex : GetEntityIndicesInScreenRect(EntityType::Vehicle, listenRect))
+        {
+            auto* vehicle = GetEntity<Vehicle>(spriteIndex);
+            if (vehicle != nullptr && vehicle->IsHead())
+            {
+                vehicle->UpdateSoundParams(vehicleSoundParamsList);
+            }
+        }
     }
 
     // Stop all playing sounds that no longer have priority to play after vehicle_update_sound_params
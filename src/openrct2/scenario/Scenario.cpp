@@ -36,6 +36,7 @@
 #include "../rct1/RCT1.h"
 #include "../rct12/RCT12.h"
 #include "../ride/Ride.h"
+#include "../ride/RideTileIndex.h"
 #include "../ride/Track.h"
 #include "../util/SawyerCoding.h"
 #include "../util/Util.h"
@@ -45,6 +46,8 @@
 #include "../world/Map.h"
 #include "../world/Park.h"
 #include "../world/Scenery.h"
+#include "../world/TileElementRegistry.h"
+#include "../world/TileElementsView.h"
 #include "../world/Water.h"
 #include "ScenarioRepository.h"
 #include "ScenarioSources.h"
@@ -554,17 +557,15 @@ static bool scenario_prepare_rides_for_save()
     }
 
     bool markTrackAsIndestructible;
-    tile_element_iterator it;
-    tile_element_iterator_begin(&it);
-    do
+    for (const auto& tilePos : tile_element_registry_get(TileElementType::Track))
     {
-        if (it.element->GetType() == TILE_ELEMENT_TYPE_TRACK)
+        for (auto* trackElement : TileElementsView<TrackElement>(tilePos.ToCoordsXY()))
         {
             markTrackAsIndestructible = false;
 
             if (isFiveCoasterObjective)
             {
-                auto ride = get_ride(it.element->AsTrack()->GetRideIndex());
+                auto ride = get_ride(trackElement->GetRideIndex());
 
                 // In the previous step, this flag was set on the first five roller coasters.
                 if (ride != nullptr && ride->lifecycle_flags & RIDE_LIFECYCLE_INDESTRUCTIBLE_TRACK)
@@ -573,9 +574,9 @@ static bool scenario_prepare_rides_for_save()
                 }
             }
 
-            it.element->AsTrack()->SetIsIndestructible(markTrackAsIndestructible);
+            trackElement->SetIsIndestructible(markTrackAsIndestructible);
         }
-    } while (tile_element_iterator_next(&it));
+    }
 
     return true;
 }
@@ -676,16 +677,21 @@ void scenario_fix_ghosts(rct_s6_data* s6)
 
 static void ride_all_has_any_track_elements(std::array<bool, RCT12_MAX_RIDES_IN_PARK>& rideIndexArray)
 {
-    tile_element_iterator it;
-    tile_element_iterator_begin(&it);
-    while (tile_element_iterator_next(&it))
+    for (ride_id_t rideIndex = 0; rideIndex < RCT12_MAX_RIDES_IN_PARK; rideIndex++)
     {
-        if (it.element->GetType() != TILE_ELEMENT_TYPE_TRACK)
-            continue;
-        if (it.element->IsGhost())
-            continue;
-
-        rideIndexArray[it.element->AsTrack()->GetRideIndex()] = true;
+        for (const auto& tilePos : ride_tile_index_get(rideIndex))
+        {
+            for (auto* trackElement : TileElementsView<TrackElement>(tilePos.ToCoordsXY()))
+            {
+                if (trackElement->GetRideIndex() == rideIndex && !trackElement->IsGhost())
+                {
+                    rideIndexArray[rideIndex] = true;
+                    break;
+                }
+            }
+            if (rideIndexArray[rideIndex])
+                break;
+        }
     }
 }
 
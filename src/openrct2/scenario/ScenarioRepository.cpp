@@ -194,8 +194,9 @@ private:
         return fs;
     }
 
+public:
     /**
-     * Reads basic information from a scenario file.
+     * Reads basic information from a scenario file, only the header and info chunks are decoded.
      */
     static bool GetScenarioInfo(const std::string& path, uint64_t timestamp, scenario_index_entry* entry)
     {
@@ -257,6 +258,7 @@ private:
         return false;
     }
 
+private:
     static scenario_index_entry CreateNewScenarioEntry(const std::string& path, uint64_t timestamp, rct_s6_info* s6Info)
     {
         scenario_index_entry entry = {};
@@ -765,6 +767,11 @@ const scenario_index_entry* scenario_repository_get_by_index(size_t index)
     return repo->GetByIndex(index);
 }
 
+bool scenario_repository_read_entry(const std::string& path, scenario_index_entry* entry)
+{
+    return ScenarioFileIndex::GetScenarioInfo(path, 0, entry);
+}
+
 bool scenario_repository_try_record_highscore(const utf8* scenarioFileName, money32 companyValue, const utf8* name)
 {
     IScenarioRepository* repo = GetScenarioRepository();
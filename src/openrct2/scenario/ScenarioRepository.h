@@ -13,6 +13,7 @@
 #include "../scenario/Scenario.h"
 
 #include <memory>
+#include <string>
 
 struct rct_object_entry;
 
@@ -80,5 +81,9 @@ IScenarioRepository* GetScenarioRepository();
 void scenario_repository_scan();
 size_t scenario_repository_get_count();
 const scenario_index_entry* scenario_repository_get_by_index(size_t index);
+/**
+ * Reads the index entry for a single scenario file without adding it to the repository.
+ */
+bool scenario_repository_read_entry(const std::string& path, scenario_index_entry* entry);
 bool scenario_repository_try_record_highscore(const utf8* scenarioFileName, money32 companyValue, const utf8* name);
 void scenario_translate(scenario_index_entry* scenarioEntry);
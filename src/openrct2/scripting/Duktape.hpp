@@ -16,10 +16,12 @@
 #    include "../world/Map.h"
 
 #    include <cstdio>
+#    include <cstring>
 #    include <dukglue/dukglue.h>
 #    include <duktape.h>
 #    include <optional>
 #    include <stdexcept>
+#    include <vector>
 
 namespace OpenRCT2::Scripting
 {
@@ -29,6 +31,44 @@ namespace OpenRCT2::Scripting
         return DukValue::take_from_stack(ctx);
     }
 
+    template<typename T> struct DukTypedArrayType;
+    template<> struct DukTypedArrayType<uint8_t>
+    {
+        static constexpr duk_uint_t Value = DUK_BUFOBJ_UINT8ARRAY;
+    };
+    template<> struct DukTypedArrayType<int16_t>
+    {
+        static constexpr duk_uint_t Value = DUK_BUFOBJ_INT16ARRAY;
+    };
+    template<> struct DukTypedArrayType<uint16_t>
+    {
+        static constexpr duk_uint_t Value = DUK_BUFOBJ_UINT16ARRAY;
+    };
+    template<> struct DukTypedArrayType<int32_t>
+    {
+        static constexpr duk_uint_t Value = DUK_BUFOBJ_INT32ARRAY;
+    };
+    template<> struct DukTypedArrayType<uint32_t>
+    {
+        static constexpr duk_uint_t Value = DUK_BUFOBJ_UINT32ARRAY;
+    };
+
+    /**
+     * Creates a typed array (e.g. Uint16Array) holding a copy of the given values.
+     */
+    template<typename T> DukValue ToDukTypedArray(duk_context* ctx, const std::vector<T>& values)
+    {
+        auto dataLen = values.size() * sizeof(T);
+        auto data = duk_push_fixed_buffer(ctx, dataLen);
+        if (dataLen != 0)
+        {
+            std::memcpy(data, values.data(), dataLen);
+        }
+        duk_push_buffer_object(ctx, -1, 0, dataLen, DukTypedArrayType<T>::Value);
+        duk_remove(ctx, -2);
+        return DukValue::take_from_stack(ctx);
+    }
+
     template<typename T> T AsOrDefault(const DukValue& value, const T& defaultValue = {}) = delete;
 
     inline std::string AsOrDefault(const DukValue& value, std::string_view defaultValue)
@@ -129,6 +169,13 @@ namespace OpenRCT2::Scripting
             duk_put_prop_string(_ctx, _idx, name);
         }
 
+        void Set(const char* name, double value)
+        {
+            EnsureObjectPushed();
+            duk_push_number(_ctx, value);
+            duk_put_prop_string(_ctx, _idx, name);
+        }
+
         void Set(const char* name, std::string_view value)
         {
             EnsureObjectPushed();
@@ -11,29 +11,43 @@
 
 #    include "HookEngine.h"
 
+#    include "Plugin.h"
 #    include "ScriptEngine.h"
 
 #    include <unordered_map>
 
 using namespace OpenRCT2::Scripting;
 
+static const std::unordered_map<std::string, HOOK_TYPE> HookTypeLookupTable({
+    { "action.query", HOOK_TYPE::ACTION_QUERY },
+    { "action.execute", HOOK_TYPE::ACTION_EXECUTE },
+    { "interval.tick", HOOK_TYPE::INTERVAL_TICK },
+    { "interval.day", HOOK_TYPE::INTERVAL_DAY },
+    { "network.chat", HOOK_TYPE::NETWORK_CHAT },
+    { "network.authenticate", HOOK_TYPE::NETWORK_AUTHENTICATE },
+    { "network.join", HOOK_TYPE::NETWORK_JOIN },
+    { "network.leave", HOOK_TYPE::NETWORK_LEAVE },
+    { "ride.ratings.calculate", HOOK_TYPE::RIDE_RATINGS_CALCULATE },
+    { "action.location", HOOK_TYPE::ACTION_LOCATION },
+    { "guest.generation", HOOK_TYPE::GUEST_GENERATION },
+});
+
 HOOK_TYPE OpenRCT2::Scripting::GetHookType(const std::string& name)
 {
-    static const std::unordered_map<std::string, HOOK_TYPE> LookupTable({
-        { "action.query", HOOK_TYPE::ACTION_QUERY },
-        { "action.execute", HOOK_TYPE::ACTION_EXECUTE },
-        { "interval.tick", HOOK_TYPE::INTERVAL_TICK },
-        { "interval.day", HOOK_TYPE::INTERVAL_DAY },
-        { "network.chat", HOOK_TYPE::NETWORK_CHAT },
-        { "network.authenticate", HOOK_TYPE::NETWORK_AUTHENTICATE },
-        { "network.join", HOOK_TYPE::NETWORK_JOIN },
-        { "network.leave", HOOK_TYPE::NETWORK_LEAVE },
-        { "ride.ratings.calculate", HOOK_TYPE::RIDE_RATINGS_CALCULATE },
-        { "action.location", HOOK_TYPE::ACTION_LOCATION },
-        { "guest.generation", HOOK_TYPE::GUEST_GENERATION },
-    });
-    auto result = LookupTable.find(name);
-    return (result != LookupTable.end()) ? result->second : HOOK_TYPE::UNDEFINED;
+    auto result = HookTypeLookupTable.find(name);
+    return (result != HookTypeLookupTable.end()) ? result->second : HOOK_TYPE::UNDEFINED;
+}
+
+std::string_view OpenRCT2::Scripting::GetHookTypeName(HOOK_TYPE type)
+{
+    for (const auto& [name, value] : HookTypeLookupTable)
+    {
+        if (value == type)
+        {
+            return name;
+        }
+    }
+    return {};
 }
 
 HookEngine::HookEngine(ScriptEngine& scriptEngine)
@@ -96,18 +110,18 @@ bool HookEngine::HasSubscriptions(HOOK_TYPE type) const
 void HookEngine::Call(HOOK_TYPE type, bool isGameStateMutable)
 {
     auto& hookList = GetHookList(type);
-    for (auto& hook : hookList.Hooks)
+    if (!hookList.Hooks.empty())
     {
-        _scriptEngine.ExecutePluginCall(hook.Owner, hook.Function, {}, isGameStateMutable);
+        CallHooks(hookList, {}, isGameStateMutable);
     }
 }
 
 void HookEngine::Call(HOOK_TYPE type, const DukValue& arg, bool isGameStateMutable)
 {
     auto& hookList = GetHookList(type);
-    for (auto& hook : hookList.Hooks)
+    if (!hookList.Hooks.empty())
     {
-        _scriptEngine.ExecutePluginCall(hook.Owner, hook.Function, { arg }, isGameStateMutable);
+        CallHooks(hookList, { arg }, isGameStateMutable);
     }
 }
 
@@ -115,34 +129,48 @@ void HookEngine::Call(
     HOOK_TYPE type, const std::initializer_list<std::pair<std::string_view, std::any>>& args, bool isGameStateMutable)
 {
     auto& hookList = GetHookList(type);
-    for (auto& hook : hookList.Hooks)
-    {
-        auto ctx = _scriptEngine.GetContext();
+    if (hookList.Hooks.empty())
+        return;
 
-        // Convert key/value pairs into an object
-        auto objIdx = duk_push_object(ctx);
-        for (const auto& arg : args)
+    // Convert key/value pairs into an object, this is shared by all the hooks
+    auto ctx = _scriptEngine.GetContext();
+    auto objIdx = duk_push_object(ctx);
+    for (const auto& arg : args)
+    {
+        if (arg.second.type() == typeid(int32_t))
         {
-            if (arg.second.type() == typeid(int32_t))
-            {
-                auto val = std::any_cast<int32_t>(arg.second);
-                duk_push_int(ctx, val);
-            }
-            else if (arg.second.type() == typeid(std::string))
-            {
-                const auto& val = std::any_cast<std::string>(arg.second);
-                duk_push_string(ctx, val.c_str());
-            }
-            else
-            {
-                throw std::runtime_error("Not implemented");
-            }
-            duk_put_prop_string(ctx, objIdx, arg.first.data());
+            auto val = std::any_cast<int32_t>(arg.second);
+            duk_push_int(ctx, val);
         }
+        else if (arg.second.type() == typeid(std::string))
+        {
+            const auto& val = std::any_cast<std::string>(arg.second);
+            duk_push_string(ctx, val.c_str());
+        }
+        else
+        {
+            throw std::runtime_error("Not implemented");
+        }
+        duk_put_prop_string(ctx, objIdx, arg.first.data());
+    }
+
+    std::vector<DukValue> dukArgs;
+    dukArgs.push_back(DukValue::take_from_stack(ctx));
+    CallHooks(hookList, dukArgs, isGameStateMutable);
+}
 
-        std::vector<DukValue> dukArgs;
-        dukArgs.push_back(DukValue::take_from_stack(ctx));
-        _scriptEngine.ExecutePluginCall(hook.Owner, hook.Function, dukArgs, isGameStateMutable);
+void HookEngine::CallHooks(HookList& hookList, const std::vector<DukValue>& args, bool isGameStateMutable)
+{
+    for (auto& hook : hookList.Hooks)
+    {
+        // The hook may be unsubscribed during the call, but the plugin will outlive it
+        auto owner = hook.Owner.get();
+        auto startTime = std::chrono::high_resolution_clock::now();
+        _scriptEngine.ExecutePluginCall(hook.Owner, hook.Function, args, isGameStateMutable);
+        if (owner != nullptr)
+        {
+            owner->AddHookCall(hookList.Type, std::chrono::high_resolution_clock::now() - startTime);
+        }
     }
 }
 
@@ -15,6 +15,7 @@
 #    include "Duktape.hpp"
 
 #    include <any>
+#    include <chrono>
 #    include <memory>
 #    include <string>
 #    include <tuple>
@@ -44,6 +45,16 @@ namespace OpenRCT2::Scripting
     };
     constexpr size_t NUM_HOOK_TYPES = static_cast<size_t>(HOOK_TYPE::COUNT);
     HOOK_TYPE GetHookType(const std::string& name);
+    std::string_view GetHookTypeName(HOOK_TYPE type);
+
+    /**
+     * The number of times a plugin's callbacks for a hook type have been called and the total time spent in them.
+     */
+    struct HookCallStats
+    {
+        uint64_t Calls{};
+        std::chrono::high_resolution_clock::duration Time{};
+    };
 
     struct Hook
     {
@@ -91,6 +102,7 @@ namespace OpenRCT2::Scripting
             HOOK_TYPE type, const std::initializer_list<std::pair<std::string_view, std::any>>& args, bool isGameStateMutable);
 
     private:
+        void CallHooks(HookList& hookList, const std::vector<DukValue>& args, bool isGameStateMutable);
         HookList& GetHookList(HOOK_TYPE type);
         const HookList& GetHookList(HOOK_TYPE type) const;
     };
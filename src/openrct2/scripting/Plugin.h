@@ -12,7 +12,9 @@
 #ifdef ENABLE_SCRIPTING
 
 #    include "Duktape.hpp"
+#    include "HookEngine.h"
 
+#    include <array>
 #    include <memory>
 #    include <string>
 #    include <string_view>
@@ -53,6 +55,7 @@ namespace OpenRCT2::Scripting
         PluginMetadata _metadata{};
         std::string _code;
         bool _hasStarted{};
+        std::array<HookCallStats, NUM_HOOK_TYPES> _hookCallStats{};
 
     public:
         std::string GetPath() const
@@ -80,6 +83,23 @@ namespace OpenRCT2::Scripting
             return _hasStarted;
         }
 
+        const HookCallStats& GetHookCallStats(HOOK_TYPE type) const
+        {
+            return _hookCallStats[static_cast<size_t>(type)];
+        }
+
+        void AddHookCall(HOOK_TYPE type, std::chrono::high_resolution_clock::duration time)
+        {
+            auto& stats = _hookCallStats[static_cast<size_t>(type)];
+            stats.Calls++;
+            stats.Time += time;
+        }
+
+        void ResetHookCallStats()
+        {
+            _hookCallStats = {};
+        }
+
         Plugin() = default;
         Plugin(duk_context* context, const std::string& path);
         Plugin(const Plugin&) = delete;
@@ -16,6 +16,7 @@
 #    include "../localisation/Formatting.h"
 #    include "../object/ObjectManager.h"
 #    include "../scenario/Scenario.h"
+#    include "../world/MiniMap.h"
 #    include "Duktape.hpp"
 #    include "HookEngine.h"
 #    include "ScConfiguration.hpp"
@@ -92,6 +93,27 @@ namespace OpenRCT2::Scripting
             }
         }
 
+        void captureMiniMap(const DukValue& options)
+        {
+            auto ctx = GetContext()->GetScriptEngine().GetContext();
+            try
+            {
+                MiniMapCaptureOptions captureOptions;
+                captureOptions.Filename = fs::u8path(AsOrDefault(options["filename"], ""));
+                captureOptions.Rotation = AsOrDefault(options["rotation"], 0) & 3;
+                captureOptions.Type = AsOrDefault(options["type"], "") == "rides" ? MiniMapType::Rides : MiniMapType::Peeps;
+                CaptureMiniMap(captureOptions);
+            }
+            catch (const DukException&)
+            {
+                duk_error(ctx, DUK_ERR_ERROR, "Invalid options.");
+            }
+            catch (const std::exception& ex)
+            {
+                duk_error(ctx, DUK_ERR_ERROR, ex.what());
+            }
+        }
+
         static DukValue CreateScObject(duk_context* ctx, ObjectType type, int32_t index)
         {
             switch (type)
@@ -230,6 +252,31 @@ namespace OpenRCT2::Scripting
             return std::make_shared<ScDisposable>([this, hookType, cookie]() { _hookEngine.Unsubscribe(hookType, cookie); });
         }
 
+        std::vector<DukValue> getHookStats() const
+        {
+            std::vector<DukValue> result;
+            auto& scriptEngine = GetContext()->GetScriptEngine();
+            auto ctx = scriptEngine.GetContext();
+            for (const auto& plugin : scriptEngine.GetPlugins())
+            {
+                for (size_t i = 0; i < NUM_HOOK_TYPES; i++)
+                {
+                    auto hookType = static_cast<HOOK_TYPE>(i);
+                    const auto& stats = plugin->GetHookCallStats(hookType);
+                    if (stats.Calls == 0)
+                        continue;
+
+                    DukObject obj(ctx);
+                    obj.Set("plugin", plugin->GetMetadata().Name);
+                    obj.Set("hook", GetHookTypeName(hookType));
+                    obj.Set("calls", stats.Calls);
+                    obj.Set("time", std::chrono::duration<double, std::milli>(stats.Time).count());
+                    result.push_back(obj.Take());
+                }
+            }
+            return result;
+        }
+
         void queryAction(const std::string& action, const DukValue& args, const DukValue& callback)
         {
             QueryOrExecuteAction(action, args, callback, false);
@@ -382,11 +429,13 @@ namespace OpenRCT2::Scripting
             dukglue_register_property(ctx, &ScContext::configuration_get, nullptr, "configuration");
             dukglue_register_property(ctx, &ScContext::sharedStorage_get, nullptr, "sharedStorage");
             dukglue_register_method(ctx, &ScContext::captureImage, "captureImage");
+            dukglue_register_method(ctx, &ScContext::captureMiniMap, "captureMiniMap");
             dukglue_register_method(ctx, &ScContext::getObject, "getObject");
             dukglue_register_method(ctx, &ScContext::getAllObjects, "getAllObjects");
             dukglue_register_method(ctx, &ScContext::getRandom, "getRandom");
             dukglue_register_method_varargs(ctx, &ScContext::formatString, "formatString");
             dukglue_register_method(ctx, &ScContext::subscribe, "subscribe");
+            dukglue_register_method(ctx, &ScContext::getHookStats, "getHookStats");
             dukglue_register_method(ctx, &ScContext::queryAction, "queryAction");
             dukglue_register_method(ctx, &ScContext::executeAction, "executeAction");
             dukglue_register_method(ctx, &ScContext::registerAction, "registerAction");
@@ -103,21 +103,130 @@ namespace OpenRCT2::Scripting
         std::vector<DukValue> getAllEntities(const std::string& type) const
         {
             std::vector<DukValue> result;
+            for (auto sprite : GetAllEntitiesOfType(type))
+            {
+                result.push_back(GetEntityAsDukValue(sprite));
+            }
+            return result;
+        }
+
+        /**
+         * Returns the properties of all entities of the given type as one typed array per property,
+         * which saves plugins that sample many entities from creating a wrapper object per entity.
+         */
+        DukValue getAllEntityColumns(const std::string& type) const
+        {
+            auto entities = GetAllEntitiesOfType(type);
+
+            DukObject result(_context);
+            result.Set("count", static_cast<int32_t>(entities.size()));
+            result.Set("id", GetColumn<uint16_t>(entities, [](const SpriteBase* sprite) { return sprite->sprite_index; }));
+            result.Set("x", GetColumn<int16_t>(entities, [](const SpriteBase* sprite) { return sprite->x; }));
+            result.Set("y", GetColumn<int16_t>(entities, [](const SpriteBase* sprite) { return sprite->y; }));
+            result.Set("z", GetColumn<int16_t>(entities, [](const SpriteBase* sprite) { return sprite->z; }));
+            if (type == "peep" || type == "guest" || type == "staff")
+            {
+                result.Set("energy", GetColumn<uint8_t>(entities, [](const SpriteBase* sprite) {
+                               return static_cast<const Peep*>(sprite)->Energy;
+                           }));
+            }
+            if (type == "guest")
+            {
+                result.Set("happiness", GetColumn<uint8_t>(entities, [](const SpriteBase* sprite) {
+                               return static_cast<const Guest*>(sprite)->Happiness;
+                           }));
+                result.Set("nausea", GetColumn<uint8_t>(entities, [](const SpriteBase* sprite) {
+                               return static_cast<const Guest*>(sprite)->Nausea;
+                           }));
+                result.Set("hunger", GetColumn<uint8_t>(entities, [](const SpriteBase* sprite) {
+                               return static_cast<const Guest*>(sprite)->Hunger;
+                           }));
+                result.Set("thirst", GetColumn<uint8_t>(entities, [](const SpriteBase* sprite) {
+                               return static_cast<const Guest*>(sprite)->Thirst;
+                           }));
+                result.Set("currentRide", GetColumn<uint16_t>(entities, [](const SpriteBase* sprite) {
+                               auto guest = static_cast<const Guest*>(sprite);
+                               return static_cast<uint16_t>(IsGuestAtRide(guest) ? guest->CurrentRide : RIDE_ID_NULL);
+                           }));
+            }
+            return result.Take();
+        }
+
+        /**
+         * Returns the raw tile elements of a range of tiles in one buffer. offsets[i] is the index of the
+         * first element of the i-th tile (row major, starting from x, y) and offsets[i + 1] is one past its last.
+         */
+        DukValue getTileRangeData(int32_t x, int32_t y, int32_t width, int32_t height) const
+        {
+            if (width <= 0 || height <= 0 || x < 0 || y < 0 || x + width > gMapSize || y + height > gMapSize)
+            {
+                duk_error(_context, DUK_ERR_RANGE_ERROR, "Invalid tile range.");
+            }
+
+            std::vector<uint32_t> offsets;
+            offsets.reserve(static_cast<size_t>(width) * height + 1);
+            std::vector<uint8_t> data;
+            uint32_t numElements = 0;
+            for (int32_t yy = y; yy < y + height; yy++)
+            {
+                for (int32_t xx = x; xx < x + width; xx++)
+                {
+                    offsets.push_back(numElements);
+                    auto element = map_get_first_element_at(TileCoordsXY(xx, yy).ToCoordsXY());
+                    if (element == nullptr)
+                        continue;
+
+                    auto first = reinterpret_cast<const uint8_t*>(element);
+                    uint32_t count = 0;
+                    do
+                    {
+                        count++;
+                    } while (!(element++)->IsLastForTile());
+                    data.insert(data.end(), first, first + count * sizeof(TileElement));
+                    numElements += count;
+                }
+            }
+            offsets.push_back(numElements);
+
+            DukObject result(_context);
+            result.Set("offsets", ToDukTypedArray(_context, offsets));
+            result.Set("data", ToDukTypedArray(_context, data));
+            return result.Take();
+        }
+
+        static void Register(duk_context* ctx)
+        {
+            dukglue_register_property(ctx, &ScMap::size_get, nullptr, "size");
+            dukglue_register_property(ctx, &ScMap::numRides_get, nullptr, "numRides");
+            dukglue_register_property(ctx, &ScMap::numEntities_get, nullptr, "numEntities");
+            dukglue_register_property(ctx, &ScMap::rides_get, nullptr, "rides");
+            dukglue_register_method(ctx, &ScMap::getRide, "getRide");
+            dukglue_register_method(ctx, &ScMap::getTile, "getTile");
+            dukglue_register_method(ctx, &ScMap::getEntity, "getEntity");
+            dukglue_register_method(ctx, &ScMap::getAllEntities, "getAllEntities");
+            dukglue_register_method(ctx, &ScMap::getAllEntityColumns, "getAllEntityColumns");
+            dukglue_register_method(ctx, &ScMap::getTileRangeData, "getTileRangeData");
+        }
+
+    private:
+        std::vector<const SpriteBase*> GetAllEntitiesOfType(const std::string& type) const
+        {
+            std::vector<const SpriteBase*> result;
             if (type == "balloon")
             {
                 for (auto sprite : EntityList<Balloon>())
                 {
-                    result.push_back(GetObjectAsDukValue(_context, std::make_shared<ScEntity>(sprite->sprite_index)));
+                    result.push_back(sprite);
                 }
             }
-            if (type == "car")
+            else if (type == "car")
             {
                 for (auto trainHead : TrainManager::View())
                 {
                     for (auto carId = trainHead->sprite_index; carId != SPRITE_INDEX_NULL;)
                     {
                         auto car = GetEntity<Vehicle>(carId);
-                        result.push_back(GetObjectAsDukValue(_context, std::make_shared<ScVehicle>(carId)));
+                        result.push_back(car);
                         carId = car->next_vehicle_on_train;
                     }
                 }
@@ -126,48 +235,67 @@ namespace OpenRCT2::Scripting
             {
                 for (auto sprite : EntityList<Litter>())
                 {
-                    result.push_back(GetObjectAsDukValue(_context, std::make_shared<ScEntity>(sprite->sprite_index)));
+                    result.push_back(sprite);
                 }
             }
             else if (type == "duck")
             {
                 for (auto sprite : EntityList<Duck>())
                 {
-                    result.push_back(GetObjectAsDukValue(_context, std::make_shared<ScEntity>(sprite->sprite_index)));
+                    result.push_back(sprite);
                 }
             }
-            else if (type == "peep")
+            else if (type == "peep" || type == "guest" || type == "staff")
             {
-                for (auto sprite : EntityList<Guest>())
+                if (type != "staff")
                 {
-                    result.push_back(GetObjectAsDukValue(_context, std::make_shared<ScGuest>(sprite->sprite_index)));
+                    for (auto sprite : EntityList<Guest>())
+                    {
+                        result.push_back(sprite);
+                    }
                 }
-                for (auto sprite : EntityList<Staff>())
+                if (type != "guest")
                 {
-                    result.push_back(GetObjectAsDukValue(_context, std::make_shared<ScStaff>(sprite->sprite_index)));
+                    for (auto sprite : EntityList<Staff>())
+                    {
+                        result.push_back(sprite);
+                    }
                 }
             }
             else
             {
                 duk_error(_context, DUK_ERR_ERROR, "Invalid entity type.");
             }
-
             return result;
         }
 
-        static void Register(duk_context* ctx)
+        template<typename T, typename TFunc>
+        DukValue GetColumn(const std::vector<const SpriteBase*>& entities, TFunc getValue) const
         {
-            dukglue_register_property(ctx, &ScMap::size_get, nullptr, "size");
-            dukglue_register_property(ctx, &ScMap::numRides_get, nullptr, "numRides");
-            dukglue_register_property(ctx, &ScMap::numEntities_get, nullptr, "numEntities");
-            dukglue_register_property(ctx, &ScMap::rides_get, nullptr, "rides");
-            dukglue_register_method(ctx, &ScMap::getRide, "getRide");
-            dukglue_register_method(ctx, &ScMap::getTile, "getTile");
-            dukglue_register_method(ctx, &ScMap::getEntity, "getEntity");
-            dukglue_register_method(ctx, &ScMap::getAllEntities, "getAllEntities");
+            std::vector<T> values;
+            values.reserve(entities.size());
+            for (auto sprite : entities)
+            {
+                values.push_back(static_cast<T>(getValue(sprite)));
+            }
+            return ToDukTypedArray(_context, values);
+        }
+
+        static bool IsGuestAtRide(const Guest* guest)
+        {
+            switch (guest->State)
+            {
+                case PeepState::QueuingFront:
+                case PeepState::OnRide:
+                case PeepState::LeavingRide:
+                case PeepState::Queuing:
+                case PeepState::EnteringRide:
+                    return true;
+                default:
+                    return false;
+            }
         }
 
-    private:
         DukValue GetEntityAsDukValue(const SpriteBase* sprite) const
         {
             auto spriteId = sprite->sprite_index;
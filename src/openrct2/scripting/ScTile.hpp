@@ -14,11 +14,14 @@
 #    include "../Context.h"
 #    include "../common.h"
 #    include "../core/Guard.hpp"
+#    include "../ride/RideGeometryCache.h"
+#    include "../ride/RideTileIndex.h"
 #    include "../ride/Track.h"
 #    include "../world/Footpath.h"
 #    include "../world/Scenery.h"
 #    include "../world/Sprite.h"
 #    include "../world/Surface.h"
+#    include "../world/TileElementRegistry.h"
 #    include "Duktape.hpp"
 #    include "ScriptEngine.h"
 
@@ -1475,6 +1478,9 @@ namespace OpenRCT2::Scripting
 
         void Invalidate()
         {
+            // The element may have been changed into one that the indexes need to know about
+            ride_tile_index_add_element(_coords, _element);
+            tile_element_registry_add(_coords, static_cast<TileElementType>(_element->GetType()));
             map_invalidate_tile_full(_coords);
         }
 
@@ -1648,7 +1654,7 @@ namespace OpenRCT2::Scripting
                 auto numElements = dataLen / sizeof(TileElement);
                 if (numElements == 0)
                 {
-                    map_set_tile_element(TileCoordsXY(_coords), nullptr);
+                    map_clear_tile_elements(TileCoordsXY(_coords));
                 }
                 else
                 {
@@ -1676,11 +1682,26 @@ namespace OpenRCT2::Scripting
                     }
                     else
                     {
+                        // Remove the elements that are no longer needed so the map keeps count of them
+                        for (auto i = currentNumElements; i > numElements; i--)
+                        {
+                            tile_element_remove(&first[i - 1]);
+                        }
                         std::memcpy(first, data, numElements * sizeof(TileElement));
                         // Safely force last tile flag for last element to avoid read overrun
                         first[numElements - 1].SetLastForTile(true);
                     }
+
+                    first = GetFirstElement();
+                    auto newNumElements = GetNumElements(first);
+                    for (size_t i = 0; i < newNumElements; i++)
+                    {
+                        ride_tile_index_add_element(_coords, &first[i]);
+                        tile_element_registry_add(_coords, static_cast<TileElementType>(first[i].GetType()));
+                    }
                 }
+                // The elements may have been reordered
+                ride_geometry_cache_invalidate_tile(_coords);
                 map_invalidate_tile_full(_coords);
             }
         }
@@ -1733,6 +1754,7 @@ namespace OpenRCT2::Scripting
                         first[i].SetLastForTile(false);
                     }
                     first[origNumElements].SetLastForTile(true);
+                    ride_geometry_cache_invalidate_tile(_coords);
                     map_invalidate_tile_full(_coords);
                     result = std::make_shared<ScTileElement>(_coords, &first[index]);
                 }
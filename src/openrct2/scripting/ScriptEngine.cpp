@@ -1091,11 +1091,10 @@ static std::unique_ptr<GameAction> CreateGameActionFromActionId(const std::strin
 
 void ScriptEngine::RunGameActionHooks(const GameAction& action, std::unique_ptr<GameActions::Result>& result, bool isExecute)
 {
-    DukStackFrame frame(_context);
-
     auto hookType = isExecute ? HOOK_TYPE::ACTION_EXECUTE : HOOK_TYPE::ACTION_QUERY;
     if (_hookEngine.HasSubscriptions(hookType))
     {
+        DukStackFrame frame(_context);
         DukObject obj(_context);
 
         auto actionId = action.GetType();
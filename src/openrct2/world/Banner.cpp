@@ -25,12 +25,16 @@
 #include "MapAnimation.h"
 #include "Park.h"
 #include "Scenery.h"
+#include "TileElementRegistry.h"
+#include "TileElementsView.h"
 
 #include <algorithm>
 #include <cstring>
 #include <iterator>
 #include <limits>
 
+using namespace OpenRCT2;
+
 static Banner _banners[MAX_BANNERS];
 
 std::string Banner::GetText() const
@@ -275,55 +279,45 @@ void fix_duplicated_banners()
 {
     // For each banner in the map, check if the banner index is in use already, and if so, create a new entry for it
     bool activeBanners[std::size(_banners)]{};
-    for (int y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL; y++)
+    for (const auto& tilePos : tile_element_registry_get(TileElementType::Banner))
     {
-        for (int x = 0; x < MAXIMUM_MAP_SIZE_TECHNICAL; x++)
+        // TODO: Handle walls and large-scenery that use banner indices too. Large scenery can be tricky, as they
+        // occupy multiple tiles that should both refer to the same banner index.
+        for (auto* bannerElement : TileElementsView<BannerElement>(tilePos.ToCoordsXY()))
         {
-            auto tileElement = map_get_first_element_at(TileCoordsXY{ x, y }.ToCoordsXY());
-            if (tileElement != nullptr)
+            auto bannerIndex = bannerElement->GetIndex();
+            if (bannerIndex == BANNER_INDEX_NULL)
+                continue;
+
+            if (activeBanners[bannerIndex])
             {
-                do
+                log_info(
+                    "Duplicated banner with index %d found at x = %d, y = %d and z = %d.", bannerIndex, tilePos.x, tilePos.y,
+                    bannerElement->base_height);
+
+                // Banner index is already in use by another banner, so duplicate it
+                auto newBannerIndex = create_new_banner(GAME_COMMAND_FLAG_APPLY);
+                if (newBannerIndex == BANNER_INDEX_NULL)
                 {
-                    // TODO: Handle walls and large-scenery that use banner indices too. Large scenery can be tricky, as they
-                    // occupy multiple tiles that should both refer to the same banner index.
-                    if (tileElement->GetType() == TILE_ELEMENT_TYPE_BANNER)
-                    {
-                        auto bannerIndex = tileElement->AsBanner()->GetIndex();
-                        if (bannerIndex == BANNER_INDEX_NULL)
-                            continue;
-
-                        if (activeBanners[bannerIndex])
-                        {
-                            log_info(
-                                "Duplicated banner with index %d found at x = %d, y = %d and z = %d.", bannerIndex, x, y,
-                                tileElement->base_height);
-
-                            // Banner index is already in use by another banner, so duplicate it
-                            auto newBannerIndex = create_new_banner(GAME_COMMAND_FLAG_APPLY);
-                            if (newBannerIndex == BANNER_INDEX_NULL)
-                            {
-                                log_error("Failed to create new banner.");
-                                continue;
-                            }
-                            Guard::Assert(!activeBanners[newBannerIndex]);
-
-                            // Copy over the original banner, but update the location
-                            auto newBanner = GetBanner(newBannerIndex);
-                            auto oldBanner = GetBanner(bannerIndex);
-                            if (oldBanner != nullptr && newBanner != nullptr)
-                            {
-                                *newBanner = *oldBanner;
-                                newBanner->position = { x, y };
-                            }
-
-                            tileElement->AsBanner()->SetIndex(newBannerIndex);
-                        }
-
-                        // Mark banner index as in-use
-                        activeBanners[bannerIndex] = true;
-                    }
-                } while (!(tileElement++)->IsLastForTile());
+                    log_error("Failed to create new banner.");
+                    continue;
+                }
+                Guard::Assert(!activeBanners[newBannerIndex]);
+
+                // Copy over the original banner, but update the location
+                auto newBanner = GetBanner(newBannerIndex);
+                auto oldBanner = GetBanner(bannerIndex);
+                if (oldBanner != nullptr && newBanner != nullptr)
+                {
+                    *newBanner = *oldBanner;
+                    newBanner->position = tilePos;
+                }
+
+                bannerElement->SetIndex(newBannerIndex);
             }
+
+            // Mark banner index as in-use
+            activeBanners[bannerIndex] = true;
         }
     }
 }
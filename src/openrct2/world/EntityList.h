@@ -30,6 +30,20 @@ uint16_t GetMiscEntityCount();
 uint16_t GetNumFreeEntities();
 const std::vector<uint16_t>& GetEntityTileList(const CoordsXY& spritePos);
 
+/**
+ * The entities of the given type whose sprite bounds overlap the given rect of the screen in the current rotation, in
+ * sprite_index order. Only the tiles that can be drawn within the rect are searched, so this is much cheaper than walking
+ * the entity list when the rect is a viewport.
+ */
+std::vector<uint16_t> GetEntityIndicesInScreenRect(EntityType type, const ScreenRect& rect);
+
+/**
+ * Litter is also indexed in coarse cells of LITTER_GRID_CELL_SIZE so that nearby litter can be found without visiting
+ * all litter or the entity lists of every tile around a location. Each cell is in sprite_index order.
+ */
+constexpr const int32_t LITTER_GRID_CELL_SIZE = 4 * COORDS_XY_STEP;
+const std::vector<uint16_t>& GetLitterGridCell(const CoordsXY& loc);
+
 template<typename T> class EntityTileIterator
 {
 private:
@@ -37,6 +37,8 @@
 #include "../object/ObjectManager.h"
 #include "../object/TerrainSurfaceObject.h"
 #include "../ride/RideData.h"
+#include "../ride/RideGeometryCache.h"
+#include "../ride/RideTileIndex.h"
 #include "../ride/Track.h"
 #include "../ride/TrackData.h"
 #include "../ride/TrackDesign.h"
@@ -48,17 +50,22 @@
 #include "Footpath.h"
 #include "LargeScenery.h"
 #include "MapAnimation.h"
+#include "MiniMap.h"
 #include "Park.h"
 #include "Scenery.h"
 #include "SmallScenery.h"
 #include "Surface.h"
+#include "TileElementRegistry.h"
 #include "TileElementsView.h"
 #include "TileInspector.h"
 #include "Wall.h"
 
 #include <algorithm>
 #include <iterator>
+#include <limits>
+#include <map>
 #include <memory>
+#include <optional>
 
 using namespace OpenRCT2;
 
@@ -108,6 +115,30 @@ std::vector<PeepSpawn> gPeepSpawns;
 TileElement* gNextFreeTileElement;
 uint32_t gNextFreeTileElementPointerIndex;
 
+// Number of extra element slots given to a tile when its elements have to be moved to make room for a new one
+static constexpr uint32_t TileElementGrowthReserve = 2;
+// Free runs of this length or longer share the last size class
+static constexpr uint32_t TileElementLargestSizeClass = 16;
+// Compaction starts once this many elements are free or the used storage grows beyond the given size
+static constexpr uint32_t TileElementCompactionFreeThreshold = 4096;
+static constexpr uint32_t TileElementCompactionUsedThreshold = MAX_TILE_ELEMENTS / 4 * 3;
+// Number of tiles trimmed and free runs looked at on each insertion while compacting the element storage
+static constexpr uint32_t TileElementCompactionBudget = 256;
+
+// Number of elements on the map
+static uint32_t _tileElementCount;
+// Number of element slots owned by each tile, starting at its first element
+static uint16_t _tileElementCapacity[MAX_TILE_TILE_ELEMENT_POINTERS];
+// The tile owning the run of elements starting at each slot, only meaningful at the start of a run
+static uint16_t _tileElementRunOwner[MAX_TILE_ELEMENTS_WITH_SPARE_ROOM];
+// Unused runs of elements below gNextFreeTileElement, by start index
+static std::map<uint32_t, uint32_t> _tileElementFreeRuns;
+// Start indices of free runs by length, entries are validated against _tileElementFreeRuns when taken
+static std::array<std::vector<uint32_t>, TileElementLargestSizeClass + 1> _tileElementFreeRunsBySize;
+static uint32_t _tileElementNumFree;
+static bool _tileElementCompacting;
+static uint16_t _tileElementTrimPosition;
+
 bool gLandMountainMode;
 bool gLandPaintMode;
 bool gClearSmallScenery;
@@ -120,6 +151,11 @@ uint16_t gLandRemainingConstructionSales;
 bool gMapLandRightsUpdateSuccess;
 
 static void clear_elements_at(const CoordsXY& loc);
+static bool map_find_element_tile(const TileElement* tileElement, CoordsXY& loc);
+static uint32_t tile_element_get_index(const TileElement* tileElement);
+static uint32_t tile_element_count_for_tile(const TileElement* tileElement);
+static bool tile_element_tile_owns_run(uint32_t tileIndex);
+static void map_free_element_run(uint32_t start, uint32_t length);
 static ScreenCoordsXY translate_3d_to_2d(int32_t rotation, const CoordsXY& pos);
 
 void tile_element_iterator_begin(tile_element_iterator* it)
@@ -212,6 +248,39 @@ void map_set_tile_element(const TileCoordsXY& tilePos, TileElement* elements)
         return;
     }
     gTileElementTilePointers[tilePos.x + tilePos.y * MAXIMUM_MAP_SIZE_TECHNICAL] = elements;
+    ride_geometry_cache_invalidate_tile(tilePos.ToCoordsXY());
+}
+
+/**
+ * Removes every element of a tile and gives its storage back, leaving the tile without elements.
+ */
+void map_clear_tile_elements(const TileCoordsXY& tilePos)
+{
+    if (!map_is_location_valid(tilePos.ToCoordsXY()))
+    {
+        log_error("Trying to access element outside of range");
+        return;
+    }
+
+    const auto tileIndex = tilePos.x + tilePos.y * MAXIMUM_MAP_SIZE_TECHNICAL;
+    auto* tileElement = gTileElementTilePointers[tileIndex];
+    const auto numElements = tile_element_count_for_tile(tileElement);
+    for (uint32_t i = 0; i < numElements; i++)
+    {
+        tile_element_registry_remove(static_cast<TileElementType>(tileElement[i].GetType()));
+    }
+    _tileElementCount -= std::min(_tileElementCount, numElements);
+
+    if (tile_element_tile_owns_run(tileIndex))
+    {
+        map_free_element_run(tile_element_get_index(tileElement), _tileElementCapacity[tileIndex]);
+        _tileElementCapacity[tileIndex] = 0;
+    }
+    gTileElementTilePointers[tileIndex] = nullptr;
+
+    minimap_invalidate_tiles(tilePos.ToCoordsXY(), tilePos.ToCoordsXY());
+    viewport_reset_interaction_cache();
+    ride_geometry_cache_invalidate_tile(tilePos.ToCoordsXY());
 }
 
 SurfaceElement* map_get_surface_element_at(const CoordsXY& coords)
@@ -372,6 +441,12 @@ void map_update_tile_pointers()
     }
 
     gNextFreeTileElement = tileElement;
+    map_reset_element_allocator();
+
+    // The whole map may have been replaced
+    minimap_invalidate_all();
+    ride_tile_index_invalidate();
+    tile_element_registry_invalidate();
 }
 
 /**
@@ -912,6 +987,21 @@ bool map_is_location_at_edge(const CoordsXY& loc)
  */
 void tile_element_remove(TileElement* tileElement)
 {
+    CoordsXY loc;
+    if (map_find_element_tile(tileElement, loc))
+    {
+        minimap_invalidate_tiles(loc, loc);
+        ride_geometry_cache_invalidate_tile(loc);
+    }
+    else
+    {
+        minimap_invalidate_all();
+        ride_geometry_cache_invalidate();
+    }
+    tile_element_registry_remove(static_cast<TileElementType>(tileElement->GetType()));
+    // Elements above the removed one move, hit-test results may point to them
+    viewport_reset_interaction_cache();
+
     // Replace Nth element by (N+1)th element.
     // This loop will make tileElement point to the old last element position,
     // after copy it to it's new position
@@ -925,11 +1015,11 @@ void tile_element_remove(TileElement* tileElement)
 
     // Mark the latest element with the last element flag.
     (tileElement - 1)->SetLastForTile(true);
+    // The slot stays reserved for the tile so that it can grow again without being moved
     tileElement->base_height = MAX_ELEMENT_HEIGHT;
-
-    if ((tileElement + 1) == gNextFreeTileElement)
+    if (_tileElementCount > 0)
     {
-        gNextFreeTileElement--;
+        _tileElementCount--;
     }
 }
 
@@ -1031,6 +1121,334 @@ void map_invalidate_selection_rect()
     viewports_invalidate(left, top, right, bottom);
 }
 
+static uint32_t tile_element_get_index(const TileElement* tileElement)
+{
+    return static_cast<uint32_t>(tileElement - gTileElements);
+}
+
+static bool tile_element_is_in_storage(const TileElement* tileElement)
+{
+    return tileElement >= gTileElements && tileElement < &gTileElements[MAX_TILE_ELEMENTS_WITH_SPARE_ROOM];
+}
+
+/**
+ * Whether the elements the tile points to are in a run of the storage owned by the tile. Tile pointers are sometimes
+ * swapped for elements that live elsewhere, e.g. while previewing ride construction.
+ */
+static bool tile_element_tile_owns_run(uint32_t tileIndex)
+{
+    const auto* firstElement = gTileElementTilePointers[tileIndex];
+    return _tileElementCapacity[tileIndex] != 0 && tile_element_is_in_storage(firstElement)
+        && _tileElementRunOwner[tile_element_get_index(firstElement)] == tileIndex;
+}
+
+/**
+ * Finds the tile whose run of the storage holds the element, returns false if the element is not in the storage.
+ */
+static bool map_find_element_tile(const TileElement* tileElement, CoordsXY& loc)
+{
+    if (!tile_element_is_in_storage(tileElement))
+        return false;
+
+    // Runs are at most as long as the largest capacity, so the start of the run is not far below the element
+    const auto elementIndex = tile_element_get_index(tileElement);
+    const auto lowestStart = elementIndex - std::min<uint32_t>(elementIndex, std::numeric_limits<uint16_t>::max());
+    for (auto runStart = elementIndex + 1; runStart-- > lowestStart;)
+    {
+        // Owners are only kept up to date at the start of runs, stale entries fail the checks
+        const auto tileIndex = _tileElementRunOwner[runStart];
+        if (gTileElementTilePointers[tileIndex] == &gTileElements[runStart] && tile_element_tile_owns_run(tileIndex)
+            && elementIndex < runStart + _tileElementCapacity[tileIndex])
+        {
+            loc = TileCoordsXY{ tileIndex % MAXIMUM_MAP_SIZE_TECHNICAL, tileIndex / MAXIMUM_MAP_SIZE_TECHNICAL }
+                      .ToCoordsXY();
+            return true;
+        }
+    }
+    return false;
+}
+
+static uint32_t tile_element_count_for_tile(const TileElement* tileElement)
+{
+    uint32_t count = 0;
+    if (tileElement != nullptr)
+    {
+        do
+        {
+            count++;
+        } while (!(tileElement++)->IsLastForTile());
+    }
+    return count;
+}
+
+static void map_set_element_run_owner(uint32_t tileIndex, uint32_t start, uint32_t capacity)
+{
+    gTileElementTilePointers[tileIndex] = &gTileElements[start];
+    _tileElementCapacity[tileIndex] = static_cast<uint16_t>(capacity);
+    _tileElementRunOwner[start] = static_cast<uint16_t>(tileIndex);
+}
+
+static void map_add_free_element_run(uint32_t start, uint32_t length)
+{
+    _tileElementFreeRuns.emplace(start, length);
+    _tileElementNumFree += length;
+
+    auto& bySize = _tileElementFreeRunsBySize[std::min(length, TileElementLargestSizeClass)];
+    bySize.push_back(start);
+    // Drop stale entries once they start to outnumber the free runs
+    if (bySize.size() > 64 && bySize.size() > _tileElementFreeRuns.size() * 2)
+    {
+        bySize.erase(
+            std::remove_if(
+                bySize.begin(), bySize.end(),
+                [](uint32_t runStart) {
+                    auto it = _tileElementFreeRuns.find(runStart);
+                    return it == _tileElementFreeRuns.end();
+                }),
+            bySize.end());
+    }
+}
+
+static void map_erase_free_element_run(std::map<uint32_t, uint32_t>::iterator it)
+{
+    _tileElementNumFree -= it->second;
+    _tileElementFreeRuns.erase(it);
+}
+
+/**
+ * Returns a run of elements to the allocator, merging it with neighbouring free runs. Runs that end up at the top of
+ * the used storage are given back to gNextFreeTileElement.
+ */
+static void map_free_element_run(uint32_t start, uint32_t length)
+{
+    if (length == 0)
+        return;
+
+    for (uint32_t i = 0; i < length; i++)
+    {
+        gTileElements[start + i].base_height = MAX_ELEMENT_HEIGHT;
+    }
+
+    auto next = _tileElementFreeRuns.find(start + length);
+    if (next != _tileElementFreeRuns.end())
+    {
+        length += next->second;
+        map_erase_free_element_run(next);
+    }
+
+    auto prev = _tileElementFreeRuns.lower_bound(start);
+    if (prev != _tileElementFreeRuns.begin())
+    {
+        prev--;
+        if (prev->first + prev->second == start)
+        {
+            start = prev->first;
+            length += prev->second;
+            map_erase_free_element_run(prev);
+        }
+    }
+
+    if (start + length == tile_element_get_index(gNextFreeTileElement))
+    {
+        gNextFreeTileElement = &gTileElements[start];
+    }
+    else
+    {
+        map_add_free_element_run(start, length);
+    }
+}
+
+/**
+ * Takes a free run of at least minLength elements, any part of it beyond maxLength stays free.
+ */
+static std::optional<std::pair<uint32_t, uint32_t>> map_take_free_element_run(uint32_t minLength, uint32_t maxLength)
+{
+    for (auto sizeClass = std::min(minLength, TileElementLargestSizeClass); sizeClass <= TileElementLargestSizeClass;
+         sizeClass++)
+    {
+        auto& bySize = _tileElementFreeRunsBySize[sizeClass];
+        for (size_t i = bySize.size(); i > 0; i--)
+        {
+            auto start = bySize[i - 1];
+            auto it = _tileElementFreeRuns.find(start);
+            if (it == _tileElementFreeRuns.end() || std::min(it->second, TileElementLargestSizeClass) != sizeClass)
+            {
+                // The run has since been taken, merged or resized
+                bySize[i - 1] = bySize.back();
+                bySize.pop_back();
+                continue;
+            }
+
+            auto length = it->second;
+            if (length < minLength)
+                continue;
+
+            bySize[i - 1] = bySize.back();
+            bySize.pop_back();
+            map_erase_free_element_run(it);
+
+            auto taken = std::min(length, maxLength);
+            if (length > taken)
+            {
+                map_add_free_element_run(start + taken, length - taken);
+            }
+            return std::make_pair(start, taken);
+        }
+    }
+    return std::nullopt;
+}
+
+/**
+ * Finds room for the elements of a tile, preferring a reused free run over growing the used storage. The tile is given
+ * a small growth reserve when there is room for it.
+ */
+static std::optional<uint32_t> map_allocate_element_run(uint32_t numElements, uint32_t& capacity)
+{
+    const auto wanted = numElements + TileElementGrowthReserve;
+    if (auto freeRun = map_take_free_element_run(numElements, wanted))
+    {
+        capacity = freeRun->second;
+        return freeRun->first;
+    }
+
+    const auto start = tile_element_get_index(gNextFreeTileElement);
+    const auto available = MAX_TILE_ELEMENTS_WITH_SPARE_ROOM - start;
+    if (available < numElements)
+        return std::nullopt;
+
+    capacity = std::min(wanted, available);
+    gNextFreeTileElement += capacity;
+    return start;
+}
+
+/**
+ * Rebuilds the allocator state from the tile pointers. Must be called whenever the element storage has been replaced
+ * without going through tile_element_insert.
+ */
+void map_reset_element_allocator()
+{
+    _tileElementFreeRuns.clear();
+    for (auto& bySize : _tileElementFreeRunsBySize)
+    {
+        bySize.clear();
+    }
+    _tileElementNumFree = 0;
+    _tileElementCompacting = false;
+    _tileElementTrimPosition = 0;
+    _tileElementCount = 0;
+
+    std::vector<bool> used(MAX_TILE_ELEMENTS_WITH_SPARE_ROOM);
+    uint32_t top = 0;
+    for (uint32_t tileIndex = 0; tileIndex < MAX_TILE_TILE_ELEMENT_POINTERS; tileIndex++)
+    {
+        auto* firstElement = gTileElementTilePointers[tileIndex];
+        if (!tile_element_is_in_storage(firstElement))
+        {
+            _tileElementCapacity[tileIndex] = 0;
+            continue;
+        }
+
+        auto start = tile_element_get_index(firstElement);
+        auto count = tile_element_count_for_tile(firstElement);
+        _tileElementCapacity[tileIndex] = static_cast<uint16_t>(count);
+        _tileElementRunOwner[start] = static_cast<uint16_t>(tileIndex);
+        _tileElementCount += count;
+        for (uint32_t i = start; i < start + count; i++)
+        {
+            used[i] = true;
+        }
+        top = std::max(top, start + count);
+    }
+    gNextFreeTileElement = &gTileElements[top];
+
+    uint32_t runStart = 0;
+    for (uint32_t i = 0; i <= top; i++)
+    {
+        if (i == top || used[i])
+        {
+            if (i > runStart)
+            {
+                map_add_free_element_run(runStart, i - runStart);
+            }
+            runStart = i + 1;
+        }
+    }
+
+    // Elements may have moved
+    viewport_reset_interaction_cache();
+    ride_geometry_cache_invalidate();
+}
+
+uint32_t map_get_num_tile_elements()
+{
+    return _tileElementCount;
+}
+
+/**
+ * Gives back the growth reserve of tiles that have lost elements, a few tiles on every insertion. While compacting, the
+ * tile that is inserted into is also moved down into a free run below it, see map_take_lower_free_element_run, so that
+ * free space gradually collects at the top of the used storage where it is given back to gNextFreeTileElement. This keeps
+ * the storage from filling up with holes and having to be reorganised all at once.
+ *
+ * Elements of other tiles are never moved, so pointers to them stay valid across an insertion.
+ */
+static void map_compact_elements()
+{
+    if (_tileElementNumFree >= TileElementCompactionFreeThreshold
+        || tile_element_get_index(gNextFreeTileElement) >= TileElementCompactionUsedThreshold)
+    {
+        _tileElementCompacting = true;
+    }
+    else if (_tileElementNumFree < TileElementCompactionFreeThreshold / 2)
+    {
+        _tileElementCompacting = false;
+    }
+    if (!_tileElementCompacting)
+        return;
+
+    for (uint32_t i = 0; i < TileElementCompactionBudget; i++)
+    {
+        const auto tileIndex = _tileElementTrimPosition++;
+        if (!tile_element_tile_owns_run(tileIndex))
+            continue;
+
+        const auto wanted = tile_element_count_for_tile(gTileElementTilePointers[tileIndex]) + TileElementGrowthReserve;
+        const auto capacity = _tileElementCapacity[tileIndex];
+        if (capacity > wanted)
+        {
+            _tileElementCapacity[tileIndex] = static_cast<uint16_t>(wanted);
+            map_free_element_run(
+                tile_element_get_index(gTileElementTilePointers[tileIndex]) + wanted, capacity - wanted);
+        }
+    }
+}
+
+/**
+ * Takes the lowest free run that starts below the given slot and has room for numElements, only looking at a few runs.
+ */
+static std::optional<uint32_t> map_take_lower_free_element_run(uint32_t below, uint32_t numElements, uint32_t& capacity)
+{
+    uint32_t budget = TileElementCompactionBudget;
+    for (auto it = _tileElementFreeRuns.begin(); it != _tileElementFreeRuns.end() && it->first < below && budget > 0;
+         it++, budget--)
+    {
+        if (it->second < numElements)
+            continue;
+
+        const auto start = it->first;
+        const auto length = it->second;
+        map_erase_free_element_run(it);
+
+        capacity = std::min(length, numElements + TileElementGrowthReserve);
+        if (length > capacity)
+        {
+            map_add_free_element_run(start + capacity, length - capacity);
+        }
+        return start;
+    }
+    return std::nullopt;
+}
+
 /**
  *
  *  rct2: 0x0068B111
@@ -1084,9 +1502,9 @@ bool map_check_free_elements_and_reorganise(int32_t numElements)
     {
         auto tileElementEnd = &gTileElements[MAX_TILE_ELEMENTS];
 
-        // Check if is there is room for the required number of elements
+        // Check if is there is room for the required number of elements, free runs left behind by moved tiles count too
         auto newTileElementEnd = gNextFreeTileElement + numElements;
-        if (newTileElementEnd > tileElementEnd)
+        if (newTileElementEnd > tileElementEnd + _tileElementNumFree)
         {
             // Defragment the map element list
             map_reorganise_elements();
@@ -1111,74 +1529,95 @@ bool map_check_free_elements_and_reorganise(int32_t numElements)
 TileElement* tile_element_insert(const CoordsXYZ& loc, int32_t occupiedQuadrants, TileElementType type)
 {
     const auto& tileLoc = TileCoordsXYZ(loc);
-    TileElement *originalTileElement, *newTileElement, *insertedElement;
-    bool isLastForTile = false;
+    const auto tileIndex = tileLoc.y * MAXIMUM_MAP_SIZE_TECHNICAL + tileLoc.x;
 
     if (!map_check_free_elements_and_reorganise(1))
     {
         log_error("Cannot insert new element");
         return nullptr;
     }
+    map_compact_elements();
 
-    newTileElement = gNextFreeTileElement;
-    originalTileElement = gTileElementTilePointers[tileLoc.y * MAXIMUM_MAP_SIZE_TECHNICAL + tileLoc.x];
-
-    // Set tile index pointer to point to new element block
-    gTileElementTilePointers[tileLoc.y * MAXIMUM_MAP_SIZE_TECHNICAL + tileLoc.x] = newTileElement;
-
-    if (originalTileElement == nullptr)
+    auto* firstElement = gTileElementTilePointers[tileIndex];
+    auto numElements = tile_element_count_for_tile(firstElement);
+    bool ownsElements = tile_element_tile_owns_run(tileIndex);
+    uint32_t newCapacity = 0;
+    std::optional<uint32_t> newStart;
+    if (ownsElements && _tileElementCompacting)
     {
-        isLastForTile = true;
+        newStart = map_take_lower_free_element_run(tile_element_get_index(firstElement), numElements + 1, newCapacity);
     }
-    else
+    if (!newStart && (!ownsElements || numElements >= _tileElementCapacity[tileIndex]))
     {
-        // Copy all elements that are below the insert height
-        while (loc.z >= originalTileElement->GetBaseZ())
+        // The tile has no room left, move its elements to a larger run
+        newStart = map_allocate_element_run(numElements + 1, newCapacity);
+        if (!newStart)
         {
-            // Copy over map element
-            *newTileElement = *originalTileElement;
-            originalTileElement->base_height = MAX_ELEMENT_HEIGHT;
-            originalTileElement++;
-            newTileElement++;
-
-            if ((newTileElement - 1)->IsLastForTile())
+            map_reorganise_elements();
+            firstElement = gTileElementTilePointers[tileIndex];
+            ownsElements = tile_element_tile_owns_run(tileIndex);
+            newStart = map_allocate_element_run(numElements + 1, newCapacity);
+            if (!newStart)
             {
-                // No more elements above the insert element
-                (newTileElement - 1)->SetLastForTile(false);
-                isLastForTile = true;
-                break;
+                log_error("Cannot insert new element");
+                return nullptr;
             }
         }
     }
+    if (newStart)
+    {
+        if (numElements != 0)
+        {
+            std::memcpy(&gTileElements[*newStart], firstElement, numElements * sizeof(TileElement));
+        }
+        if (ownsElements)
+        {
+            map_free_element_run(tile_element_get_index(firstElement), _tileElementCapacity[tileIndex]);
+        }
 
-    // Insert new map element
-    insertedElement = newTileElement;
-    newTileElement->type = 0;
-    newTileElement->SetType(static_cast<uint8_t>(type));
-    newTileElement->SetBaseZ(loc.z);
-    newTileElement->Flags = 0;
-    newTileElement->SetLastForTile(isLastForTile);
-    newTileElement->SetOccupiedQuadrants(occupiedQuadrants);
-    newTileElement->SetClearanceZ(loc.z);
-    newTileElement->owner = 0;
-    std::memset(&newTileElement->pad_05, 0, sizeof(newTileElement->pad_05));
-    std::memset(&newTileElement->pad_08, 0, sizeof(newTileElement->pad_08));
-    newTileElement++;
-
-    // Insert rest of map elements above insert height
-    if (!isLastForTile)
+        map_set_element_run_owner(tileIndex, *newStart, newCapacity);
+        firstElement = gTileElementTilePointers[tileIndex];
+    }
+
+    // Elements are kept sorted by base height, the new element goes above all others at the same height
+    uint32_t insertIndex = 0;
+    while (insertIndex < numElements && loc.z >= firstElement[insertIndex].GetBaseZ())
     {
-        do
+        insertIndex++;
+    }
+
+    bool isLastForTile = insertIndex == numElements;
+    if (isLastForTile)
+    {
+        if (numElements != 0)
         {
-            // Copy over map element
-            *newTileElement = *originalTileElement;
-            originalTileElement->base_height = MAX_ELEMENT_HEIGHT;
-            originalTileElement++;
-            newTileElement++;
-        } while (!((newTileElement - 1)->IsLastForTile()));
+            firstElement[numElements - 1].SetLastForTile(false);
+        }
+    }
+    else
+    {
+        std::memmove(
+            &firstElement[insertIndex + 1], &firstElement[insertIndex], (numElements - insertIndex) * sizeof(TileElement));
     }
 
-    gNextFreeTileElement = newTileElement;
+    minimap_invalidate_tiles(loc, loc);
+    tile_element_registry_add(loc, type);
+    viewport_reset_interaction_cache();
+    ride_geometry_cache_invalidate_tile(loc);
+    _tileElementCount++;
+
+    // Insert new map element
+    auto* insertedElement = &firstElement[insertIndex];
+    insertedElement->type = 0;
+    insertedElement->SetType(static_cast<uint8_t>(type));
+    insertedElement->SetBaseZ(loc.z);
+    insertedElement->Flags = 0;
+    insertedElement->SetLastForTile(isLastForTile);
+    insertedElement->SetOccupiedQuadrants(occupiedQuadrants);
+    insertedElement->SetClearanceZ(loc.z);
+    insertedElement->owner = 0;
+    std::memset(&insertedElement->pad_05, 0, sizeof(insertedElement->pad_05));
+    std::memset(&insertedElement->pad_08, 0, sizeof(insertedElement->pad_08));
     return insertedElement;
 }
 
@@ -1999,6 +2438,8 @@ ScreenCoordsXY translate_3d_to_2d_with_z(int32_t rotation, const CoordsXYZ& pos)
 
 static void map_invalidate_tile_under_zoom(int32_t x, int32_t y, int32_t z0, int32_t z1, int32_t maxZoom)
 {
+    minimap_invalidate_tiles({ x, y }, { x, y });
+
     if (gOpenRCT2Headless)
         return;
 
@@ -2075,6 +2516,7 @@ void map_invalidate_region(const CoordsXY& mins, const CoordsXY& maxs)
     top -= 32 + 2080;
 
     viewports_invalidate(left, top, right, bottom);
+    minimap_invalidate_tiles(mins, maxs);
 }
 
 int32_t map_get_tile_side(const CoordsXY& mapPos)
@@ -0,0 +1,336 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "MiniMap.h"
+
+#include "../drawing/Drawing.h"
+#include "../ride/Ride.h"
+#include "../ride/RideData.h"
+#include "../ride/Track.h"
+#include "Entrance.h"
+#include "Surface.h"
+
+#include <algorithm>
+#include <iterator>
+
+static constexpr uint16_t MapColour2(uint8_t colourA, uint8_t colourB)
+{
+    return (colourA << 8) | colourB;
+}
+static constexpr uint16_t MapColour(uint8_t colour)
+{
+    return MapColour2(colour, colour);
+}
+static constexpr uint16_t MapColourUnowned(uint16_t colour)
+{
+    return MapColour2((colour & 0xFF00) >> 8, PALETTE_INDEX_10);
+}
+
+/** rct2: 0x00981BCC */
+const uint16_t MiniMapRideKeyColours[8] = {
+    MapColour(PALETTE_INDEX_61),  // COLOUR_KEY_RIDE
+    MapColour(PALETTE_INDEX_42),  // COLOUR_KEY_FOOD
+    MapColour(PALETTE_INDEX_20),  // COLOUR_KEY_DRINK
+    MapColour(PALETTE_INDEX_209), // COLOUR_KEY_SOUVENIR
+    MapColour(PALETTE_INDEX_136), // COLOUR_KEY_KIOSK
+    MapColour(PALETTE_INDEX_102), // COLOUR_KEY_FIRST_AID
+    MapColour(PALETTE_INDEX_55),  // COLOUR_KEY_CASH_MACHINE
+    MapColour(PALETTE_INDEX_161), // COLOUR_KEY_TOILETS
+};
+
+static constexpr const uint16_t WaterColour = MapColour(PALETTE_INDEX_195);
+static constexpr const uint16_t TerrainColour[] = {
+    MapColour(PALETTE_INDEX_73),                     // TERRAIN_GRASS
+    MapColour(PALETTE_INDEX_40),                     // TERRAIN_SAND
+    MapColour(PALETTE_INDEX_108),                    // TERRAIN_DIRT
+    MapColour(PALETTE_INDEX_12),                     // TERRAIN_ROCK
+    MapColour(PALETTE_INDEX_62),                     // TERRAIN_MARTIAN
+    MapColour2(PALETTE_INDEX_10, PALETTE_INDEX_16),  // TERRAIN_CHECKERBOARD
+    MapColour2(PALETTE_INDEX_73, PALETTE_INDEX_108), // TERRAIN_GRASS_CLUMPS
+    MapColour(PALETTE_INDEX_141),                    // TERRAIN_ICE
+    MapColour2(PALETTE_INDEX_172, PALETTE_INDEX_10), // TERRAIN_GRID_RED
+    MapColour2(PALETTE_INDEX_54, PALETTE_INDEX_10),  // TERRAIN_GRID_YELLOW
+    MapColour2(PALETTE_INDEX_162, PALETTE_INDEX_10), // TERRAIN_GRID_BLUE
+    MapColour2(PALETTE_INDEX_102, PALETTE_INDEX_10), // TERRAIN_GRID_GREEN
+    MapColour(PALETTE_INDEX_111),                    // TERRAIN_SAND_DARK
+    MapColour(PALETTE_INDEX_222),                    // TERRAIN_SAND_LIGHT
+};
+
+static constexpr const uint16_t ElementTypeMaskColour[] = {
+    0xFFFF, // TILE_ELEMENT_TYPE_SURFACE
+    0x0000, // TILE_ELEMENT_TYPE_PATH
+    0x00FF, // TILE_ELEMENT_TYPE_TRACK
+    0xFF00, // TILE_ELEMENT_TYPE_SMALL_SCENERY
+    0x0000, // TILE_ELEMENT_TYPE_ENTRANCE
+    0xFFFF, // TILE_ELEMENT_TYPE_WALL
+    0x0000, // TILE_ELEMENT_TYPE_LARGE_SCENERY
+    0xFFFF, // TILE_ELEMENT_TYPE_BANNER
+    0x0000, // TILE_ELEMENT_TYPE_CORRUPT
+};
+
+static constexpr const uint16_t ElementTypeAddColour[] = {
+    MapColour(PALETTE_INDEX_0),                     // TILE_ELEMENT_TYPE_SURFACE
+    MapColour(PALETTE_INDEX_17),                    // TILE_ELEMENT_TYPE_PATH
+    MapColour2(PALETTE_INDEX_183, PALETTE_INDEX_0), // TILE_ELEMENT_TYPE_TRACK
+    MapColour2(PALETTE_INDEX_0, PALETTE_INDEX_99),  // TILE_ELEMENT_TYPE_SMALL_SCENERY
+    MapColour(PALETTE_INDEX_186),                   // TILE_ELEMENT_TYPE_ENTRANCE
+    MapColour(PALETTE_INDEX_0),                     // TILE_ELEMENT_TYPE_WALL
+    MapColour(PALETTE_INDEX_99),                    // TILE_ELEMENT_TYPE_LARGE_SCENERY
+    MapColour(PALETTE_INDEX_0),                     // TILE_ELEMENT_TYPE_BANNER
+    MapColour(PALETTE_INDEX_68),                    // TILE_ELEMENT_TYPE_CORRUPT
+};
+
+static constexpr size_t DirtyBitsPerWord = 64;
+static constexpr size_t NumTiles = MAXIMUM_MAP_SIZE_TECHNICAL * MAXIMUM_MAP_SIZE_TECHNICAL;
+
+static std::vector<MiniMap*> _miniMaps;
+
+static uint16_t minimap_get_pixel_colour_peep(const CoordsXY& c)
+{
+    auto* surfaceElement = map_get_surface_element_at(c);
+    if (surfaceElement == nullptr)
+        return 0;
+    uint16_t colour = TerrainColour[surfaceElement->GetSurfaceStyle()];
+    if (surfaceElement->GetWaterHeight() > 0)
+        colour = WaterColour;
+
+    if (!(surfaceElement->GetOwnership() & OWNERSHIP_OWNED))
+        colour = MapColourUnowned(colour);
+
+    const int32_t maxSupportedTileElementType = static_cast<int32_t>(std::size(ElementTypeAddColour));
+    auto tileElement = reinterpret_cast<TileElement*>(surfaceElement);
+    while (!(tileElement++)->IsLastForTile())
+    {
+        if (tileElement->IsGhost())
+        {
+            colour = MapColour(PALETTE_INDEX_21);
+            break;
+        }
+
+        int32_t tileElementType = tileElement->GetType() >> 2;
+        if (tileElementType >= maxSupportedTileElementType)
+        {
+            tileElementType = TILE_ELEMENT_TYPE_CORRUPT >> 2;
+        }
+        colour &= ElementTypeMaskColour[tileElementType];
+        colour |= ElementTypeAddColour[tileElementType];
+    }
+
+    return colour;
+}
+
+static uint16_t minimap_get_pixel_colour_ride(const CoordsXY& c)
+{
+    Ride* ride;
+    uint16_t colourA = 0;                           // highlight colour
+    uint16_t colourB = MapColour(PALETTE_INDEX_13); // surface colour (dark grey)
+
+    // as an improvement we could use first_element to show underground stuff?
+    TileElement* tileElement = reinterpret_cast<TileElement*>(map_get_surface_element_at(c));
+    do
+    {
+        if (tileElement == nullptr)
+            break;
+
+        if (tileElement->IsGhost())
+        {
+            colourA = MapColour(PALETTE_INDEX_21);
+            break;
+        }
+
+        switch (tileElement->GetType())
+        {
+            case TILE_ELEMENT_TYPE_SURFACE:
+                if (tileElement->AsSurface()->GetWaterHeight() > 0)
+                    // Why is this a different water colour as above (195)?
+                    colourB = MapColour(PALETTE_INDEX_194);
+                if (!(tileElement->AsSurface()->GetOwnership() & OWNERSHIP_OWNED))
+                    colourB = MapColourUnowned(colourB);
+                break;
+            case TILE_ELEMENT_TYPE_PATH:
+                colourA = MapColour(PALETTE_INDEX_14); // lighter grey
+                break;
+            case TILE_ELEMENT_TYPE_ENTRANCE:
+                if (tileElement->AsEntrance()->GetEntranceType() == ENTRANCE_TYPE_PARK_ENTRANCE)
+                    break;
+                ride = get_ride(tileElement->AsEntrance()->GetRideIndex());
+                if (ride != nullptr)
+                {
+                    const auto& colourKey = ride->GetRideTypeDescriptor().ColourKey;
+                    colourA = MiniMapRideKeyColours[static_cast<size_t>(colourKey)];
+                }
+                break;
+            case TILE_ELEMENT_TYPE_TRACK:
+                ride = get_ride(tileElement->AsTrack()->GetRideIndex());
+                if (ride != nullptr)
+                {
+                    const auto& colourKey = ride->GetRideTypeDescriptor().ColourKey;
+                    colourA = MiniMapRideKeyColours[static_cast<size_t>(colourKey)];
+                }
+
+                break;
+        }
+    } while (!(tileElement++)->IsLastForTile());
+
+    if (colourA != 0)
+        return colourA;
+
+    return colourB;
+}
+
+MiniMap::MiniMap()
+    : _imageData(MINI_MAP_SIZE * MINI_MAP_SIZE, PALETTE_INDEX_10)
+    , _dirtyTiles(NumTiles / DirtyBitsPerWord)
+{
+    _miniMaps.push_back(this);
+    InvalidateAll();
+}
+
+MiniMap::~MiniMap()
+{
+    _miniMaps.erase(std::remove(_miniMaps.begin(), _miniMaps.end(), this), _miniMaps.end());
+}
+
+void MiniMap::SetType(MiniMapType type)
+{
+    if (_type != type)
+    {
+        _type = type;
+        InvalidateAll();
+    }
+}
+
+void MiniMap::SetRotation(uint8_t rotation)
+{
+    if (_rotation != rotation)
+    {
+        // Tiles move to different pixels so clear the old image first
+        _rotation = rotation;
+        std::fill(_imageData.begin(), _imageData.end(), PALETTE_INDEX_10);
+        InvalidateAll();
+    }
+}
+
+void MiniMap::InvalidateAll()
+{
+    std::fill(_dirtyTiles.begin(), _dirtyTiles.end(), UINT64_MAX);
+    _anyDirty = true;
+}
+
+void MiniMap::InvalidateTile(const TileCoordsXY& tilePos)
+{
+    auto index = static_cast<size_t>(tilePos.y * MAXIMUM_MAP_SIZE_TECHNICAL + tilePos.x);
+    _dirtyTiles[index / DirtyBitsPerWord] |= 1ULL << (index % DirtyBitsPerWord);
+    _anyDirty = true;
+}
+
+void MiniMap::Update()
+{
+    if (!_anyDirty)
+        return;
+
+    for (size_t wordIndex = 0; wordIndex < _dirtyTiles.size(); wordIndex++)
+    {
+        auto word = _dirtyTiles[wordIndex];
+        if (word == 0)
+            continue;
+
+        _dirtyTiles[wordIndex] = 0;
+        for (size_t bit = 0; bit < DirtyBitsPerWord; bit++)
+        {
+            if (word & (1ULL << bit))
+            {
+                auto index = static_cast<int32_t>(wordIndex * DirtyBitsPerWord + bit);
+                DrawTile({ index % MAXIMUM_MAP_SIZE_TECHNICAL, index / MAXIMUM_MAP_SIZE_TECHNICAL });
+            }
+        }
+    }
+    _anyDirty = false;
+}
+
+/**
+ * Each line of the minimap runs diagonally down and to the right through the image, which line and where along it a
+ * tile is drawn depends on the rotation.
+ */
+void MiniMap::DrawTile(const TileCoordsXY& tilePos)
+{
+    constexpr int32_t lastTile = MAXIMUM_MAP_SIZE_TECHNICAL - 1;
+    int32_t line = 0;
+    int32_t i = 0;
+    switch (_rotation)
+    {
+        case 0:
+            line = tilePos.x;
+            i = tilePos.y;
+            break;
+        case 1:
+            line = tilePos.y;
+            i = lastTile - tilePos.x;
+            break;
+        case 2:
+            line = lastTile - tilePos.x;
+            i = lastTile - tilePos.y;
+            break;
+        case 3:
+            line = lastTile - tilePos.y;
+            i = tilePos.x;
+            break;
+    }
+
+    int32_t pos = (line * (MINI_MAP_SIZE - 1)) + MAXIMUM_MAP_SIZE_TECHNICAL - 1;
+    auto destination = _imageData.data() + ((pos / MINI_MAP_SIZE) + i) * MINI_MAP_SIZE + (pos % MINI_MAP_SIZE) + i;
+
+    auto coords = tilePos.ToCoordsXY();
+    uint16_t colour = MapColour(PALETTE_INDEX_10);
+    if (coords.x > 0 && coords.y > 0 && coords.x < gMapSizeUnits && coords.y < gMapSizeUnits)
+    {
+        switch (_type)
+        {
+            case MiniMapType::Peeps:
+                colour = minimap_get_pixel_colour_peep(coords);
+                break;
+            case MiniMapType::Rides:
+                colour = minimap_get_pixel_colour_ride(coords);
+                break;
+        }
+    }
+    destination[0] = (colour >> 8) & 0xFF;
+    destination[1] = colour;
+}
+
+void minimap_invalidate_all()
+{
+    for (auto* miniMap : _miniMaps)
+    {
+        miniMap->InvalidateAll();
+    }
+}
+
+void minimap_invalidate_tiles(const CoordsXY& mins, const CoordsXY& maxs)
+{
+    if (_miniMaps.empty())
+        return;
+
+    auto tileMins = TileCoordsXY(mins);
+    auto tileMaxs = TileCoordsXY(maxs);
+    tileMins.x = std::clamp(tileMins.x, 0, MAXIMUM_MAP_SIZE_TECHNICAL - 1);
+    tileMins.y = std::clamp(tileMins.y, 0, MAXIMUM_MAP_SIZE_TECHNICAL - 1);
+    tileMaxs.x = std::clamp(tileMaxs.x, 0, MAXIMUM_MAP_SIZE_TECHNICAL - 1);
+    tileMaxs.y = std::clamp(tileMaxs.y, 0, MAXIMUM_MAP_SIZE_TECHNICAL - 1);
+    for (auto* miniMap : _miniMaps)
+    {
+        for (int32_t y = tileMins.y; y <= tileMaxs.y; y++)
+        {
+            for (int32_t x = tileMins.x; x <= tileMaxs.x; x++)
+            {
+                miniMap->InvalidateTile({ x, y });
+            }
+        }
+    }
+}
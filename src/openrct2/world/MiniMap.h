@@ -0,0 +1,86 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+#include "Location.hpp"
+#include "Map.h"
+
+#include <vector>
+
+enum class MiniMapType : uint8_t
+{
+    Peeps,
+    Rides,
+};
+
+// The minimap is drawn isometrically with every tile covering two horizontal pixels
+constexpr int32_t MINI_MAP_SIZE = MAXIMUM_MAP_SIZE_TECHNICAL * 2;
+
+// Colours of the ride keys, indexed by RideColourKey
+extern const uint16_t MiniMapRideKeyColours[8];
+
+/**
+ * Renders the 8bpp minimap image. Only tiles that have been invalidated since the last update are redrawn, every
+ * minimap in existence is notified when a tile is invalidated on the map.
+ */
+class MiniMap
+{
+private:
+    std::vector<uint8_t> _imageData;
+    std::vector<uint64_t> _dirtyTiles;
+    bool _anyDirty{};
+    MiniMapType _type{};
+    uint8_t _rotation{};
+
+public:
+    MiniMap();
+    MiniMap(const MiniMap&) = delete;
+    MiniMap& operator=(const MiniMap&) = delete;
+    ~MiniMap();
+
+    const uint8_t* GetImageData() const
+    {
+        return _imageData.data();
+    }
+
+    MiniMapType GetType() const
+    {
+        return _type;
+    }
+    void SetType(MiniMapType type);
+
+    uint8_t GetRotation() const
+    {
+        return _rotation;
+    }
+    void SetRotation(uint8_t rotation);
+
+    void InvalidateAll();
+    void InvalidateTile(const TileCoordsXY& tilePos);
+
+    /**
+     * Redraws all tiles that have been invalidated since the last update.
+     */
+    void Update();
+
+private:
+    void DrawTile(const TileCoordsXY& tilePos);
+};
+
+/**
+ * Marks every tile as changed on all minimaps.
+ */
+void minimap_invalidate_all();
+
+/**
+ * Marks the tiles within the given range as changed on all minimaps.
+ */
+void minimap_invalidate_tiles(const CoordsXY& mins, const CoordsXY& maxs);
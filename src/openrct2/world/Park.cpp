@@ -339,19 +339,20 @@ void Park::Update(const Date& date)
 
 int32_t Park::CalculateParkSize() const
 {
+    // Every tile has a surface element so only visit those instead of every element on the map
     int32_t tiles = 0;
-    tile_element_iterator it;
-    tile_element_iterator_begin(&it);
-    do
+    for (int32_t y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL; y++)
     {
-        if (it.element->GetType() == TILE_ELEMENT_TYPE_SURFACE)
+        for (int32_t x = 0; x < MAXIMUM_MAP_SIZE_TECHNICAL; x++)
         {
-            if (it.element->AsSurface()->GetOwnership() & (OWNERSHIP_CONSTRUCTION_RIGHTS_OWNED | OWNERSHIP_OWNED))
+            auto* surfaceElement = map_get_surface_element_at(TileCoordsXY{ x, y }.ToCoordsXY());
+            if (surfaceElement != nullptr
+                && (surfaceElement->GetOwnership() & (OWNERSHIP_CONSTRUCTION_RIGHTS_OWNED | OWNERSHIP_OWNED)))
             {
                 tiles++;
             }
         }
-    } while (tile_element_iterator_next(&it));
+    }
 
     if (tiles != gParkSize)
     {
@@ -29,7 +29,9 @@
 #include <algorithm>
 #include <cmath>
 #include <iterator>
+#include <limits>
 #include <numeric>
+#include <optional>
 #include <vector>
 
 static rct_sprite _spriteList[MAX_ENTITIES];
@@ -43,6 +45,10 @@ constexpr const uint32_t SPATIAL_INDEX_LOCATION_NULL = SPATIAL_INDEX_SIZE - 1;
 
 static std::array<std::vector<uint16_t>, SPATIAL_INDEX_SIZE> gSpriteSpatialIndex;
 
+constexpr const int32_t LITTER_GRID_SIZE = (MAXIMUM_MAP_SIZE_TECHNICAL * COORDS_XY_STEP) / LITTER_GRID_CELL_SIZE;
+
+static std::array<std::vector<uint16_t>, LITTER_GRID_SIZE * LITTER_GRID_SIZE> _litterGrid;
+
 constexpr size_t GetSpatialIndexOffset(int32_t x, int32_t y)
 {
     size_t index = SPATIAL_INDEX_LOCATION_NULL;
@@ -158,6 +164,88 @@ const std::vector<uint16_t>& GetEntityTileList(const CoordsXY& spritePos)
     return gSpriteSpatialIndex[GetSpatialIndexOffset(spritePos.x, spritePos.y)];
 }
 
+std::vector<uint16_t> GetEntityIndicesInScreenRect(EntityType type, const ScreenRect& rect)
+{
+    // Sprite bounds reach at most this far from the projected entity position, their extents are 8 bit
+    constexpr int32_t MaxSpriteExtent = 255;
+    // Entities are never far below the lowest or above the highest element, balloons pop before that
+    constexpr int32_t MinEntityZ = -MaxSpriteExtent;
+    constexpr int32_t MaxEntityZ = 255 * COORDS_Z_STEP + MaxSpriteExtent;
+
+    const int32_t left = rect.GetLeft() - MaxSpriteExtent;
+    const int32_t top = rect.GetTop() - MaxSpriteExtent;
+    const int32_t right = rect.GetRight() + MaxSpriteExtent;
+    const int32_t bottom = rect.GetBottom() + MaxSpriteExtent;
+
+    // The map area that can be drawn within the rect is bounded by its corners at the lowest and highest heights
+    int32_t minX = std::numeric_limits<int32_t>::max();
+    int32_t minY = std::numeric_limits<int32_t>::max();
+    int32_t maxX = std::numeric_limits<int32_t>::min();
+    int32_t maxY = std::numeric_limits<int32_t>::min();
+    for (const auto& corner : { ScreenCoordsXY{ left, top }, ScreenCoordsXY{ right, top }, ScreenCoordsXY{ left, bottom },
+                                ScreenCoordsXY{ right, bottom } })
+    {
+        for (auto z : { MinEntityZ, MaxEntityZ })
+        {
+            auto mapPos = viewport_coord_to_map_coord(corner, z);
+            minX = std::min(minX, mapPos.x);
+            minY = std::min(minY, mapPos.y);
+            maxX = std::max(maxX, mapPos.x);
+            maxY = std::max(maxY, mapPos.y);
+        }
+    }
+
+    constexpr int32_t MaxTileXY = MAXIMUM_MAP_SIZE_TECHNICAL - 1;
+    const int32_t tileMinX = std::clamp((minX - COORDS_XY_STEP) / COORDS_XY_STEP, 0, MaxTileXY);
+    const int32_t tileMinY = std::clamp((minY - COORDS_XY_STEP) / COORDS_XY_STEP, 0, MaxTileXY);
+    const int32_t tileMaxX = std::clamp((maxX + COORDS_XY_STEP) / COORDS_XY_STEP, 0, MaxTileXY);
+    const int32_t tileMaxY = std::clamp((maxY + COORDS_XY_STEP) / COORDS_XY_STEP, 0, MaxTileXY);
+
+    std::vector<uint16_t> result;
+    for (int32_t tileX = tileMinX; tileX <= tileMaxX; tileX++)
+    {
+        for (int32_t tileY = tileMinY; tileY <= tileMaxY; tileY++)
+        {
+            for (auto spriteIndex : GetEntityTileList(TileCoordsXY{ tileX, tileY }.ToCoordsXY()))
+            {
+                const auto* entity = GetEntity(spriteIndex);
+                if (entity == nullptr || entity->Type != type || entity->sprite_left == LOCATION_NULL)
+                    continue;
+                if (entity->sprite_right < rect.GetLeft() || entity->sprite_left > rect.GetRight())
+                    continue;
+                if (entity->sprite_bottom < rect.GetTop() || entity->sprite_top > rect.GetBottom())
+                    continue;
+                result.push_back(spriteIndex);
+            }
+        }
+    }
+
+    // Callers expect the same order as the entity lists
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+static std::optional<size_t> GetLitterGridOffset(int32_t x, int32_t y)
+{
+    if (x < 0 || y < 0)
+        return std::nullopt;
+
+    auto cellX = x / LITTER_GRID_CELL_SIZE;
+    auto cellY = y / LITTER_GRID_CELL_SIZE;
+    if (cellX >= LITTER_GRID_SIZE || cellY >= LITTER_GRID_SIZE)
+        return std::nullopt;
+    return static_cast<size_t>(cellY * LITTER_GRID_SIZE + cellX);
+}
+
+const std::vector<uint16_t>& GetLitterGridCell(const CoordsXY& loc)
+{
+    static const std::vector<uint16_t> noLitter;
+    auto offset = GetLitterGridOffset(loc.x, loc.y);
+    if (!offset)
+        return noLitter;
+    return _litterGrid[*offset];
+}
+
 void SpriteBase::Invalidate()
 {
     if (sprite_left == LOCATION_NULL)
@@ -258,6 +346,10 @@ void reset_sprite_spatial_index()
     {
         vec.clear();
     }
+    for (auto& vec : _litterGrid)
+    {
+        vec.clear();
+    }
     for (size_t i = 0; i < MAX_ENTITIES; i++)
     {
         auto* spr = GetEntity(i);
@@ -453,10 +545,34 @@ static void SpriteSpatialInsert(SpriteBase* sprite, const CoordsXY& newLoc)
     auto& spatialVector = gSpriteSpatialIndex[newIndex];
     auto index = std::lower_bound(std::begin(spatialVector), std::end(spatialVector), sprite->sprite_index);
     spatialVector.insert(index, sprite->sprite_index);
+
+    if (sprite->Type == EntityType::Litter && newLoc.x != LOCATION_NULL)
+    {
+        auto offset = GetLitterGridOffset(newLoc.x, newLoc.y);
+        if (offset)
+        {
+            auto& cell = _litterGrid[*offset];
+            cell.insert(std::lower_bound(std::begin(cell), std::end(cell), sprite->sprite_index), sprite->sprite_index);
+        }
+    }
 }
 
 static void SpriteSpatialRemove(SpriteBase* sprite)
 {
+    if (sprite->Type == EntityType::Litter && sprite->x != LOCATION_NULL)
+    {
+        auto offset = GetLitterGridOffset(sprite->x, sprite->y);
+        if (offset)
+        {
+            auto& cell = _litterGrid[*offset];
+            auto index = std::lower_bound(std::begin(cell), std::end(cell), sprite->sprite_index);
+            if (index != std::end(cell) && *index == sprite->sprite_index)
+            {
+                cell.erase(index);
+            }
+        }
+    }
+
     size_t currentIndex = GetSpatialIndexOffset(sprite->x, sprite->y);
     auto& spatialVector = gSpriteSpatialIndex[currentIndex];
     auto index = std::lower_bound(std::begin(spatialVector), std::end(spatialVector), sprite->sprite_index);
@@ -555,6 +671,8 @@ void sprite_remove(SpriteBase* sprite)
 
     SpriteSpatialRemove(sprite);
     sprite_reset(sprite);
+    // Removed sprites are not invalidated, a cached hit-test may still refer to this one
+    viewport_reset_interaction_cache();
 }
 
 /**
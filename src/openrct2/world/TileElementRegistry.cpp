@@ -0,0 +1,141 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "TileElementRegistry.h"
+
+#include "Map.h"
+
+#include <algorithm>
+#include <array>
+
+static constexpr size_t NumTileElementTypes = (static_cast<size_t>(TileElementType::Corrupt) >> 2) + 1;
+
+struct TileElementRegistryList
+{
+    std::vector<TileCoordsXY> Tiles;
+    bool HasRemovals{};
+};
+
+static std::array<TileElementRegistryList, NumTileElementTypes> _registry;
+static bool _registryValid;
+
+static TileElementRegistryList* tile_element_registry_get_list(TileElementType type)
+{
+    if (type == TileElementType::Surface)
+        return nullptr;
+
+    auto index = static_cast<size_t>(type) >> 2;
+    if (index >= _registry.size())
+        return nullptr;
+    return &_registry[index];
+}
+
+static bool tile_element_registry_is_before(const TileCoordsXY& a, const TileCoordsXY& b)
+{
+    return a.y != b.y ? a.y < b.y : a.x < b.x;
+}
+
+static bool tile_element_registry_tile_has_type(const TileCoordsXY& tilePos, TileElementType type)
+{
+    const auto* tileElement = map_get_first_element_at(tilePos.ToCoordsXY());
+    if (tileElement == nullptr)
+        return false;
+    do
+    {
+        if (static_cast<TileElementType>(tileElement->GetType()) == type)
+            return true;
+    } while (!(tileElement++)->IsLastForTile());
+    return false;
+}
+
+static void tile_element_registry_rebuild()
+{
+    for (auto& list : _registry)
+    {
+        list.Tiles.clear();
+        list.HasRemovals = false;
+    }
+
+    // Visiting tiles in iterator order keeps every list sorted
+    for (int32_t y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL; y++)
+    {
+        for (int32_t x = 0; x < MAXIMUM_MAP_SIZE_TECHNICAL; x++)
+        {
+            const TileCoordsXY tilePos{ x, y };
+            const auto* tileElement = map_get_first_element_at(tilePos.ToCoordsXY());
+            if (tileElement == nullptr)
+                continue;
+            do
+            {
+                auto* list = tile_element_registry_get_list(static_cast<TileElementType>(tileElement->GetType()));
+                if (list != nullptr && (list->Tiles.empty() || list->Tiles.back() != tilePos))
+                {
+                    list->Tiles.push_back(tilePos);
+                }
+            } while (!(tileElement++)->IsLastForTile());
+        }
+    }
+    _registryValid = true;
+}
+
+void tile_element_registry_invalidate()
+{
+    _registryValid = false;
+}
+
+void tile_element_registry_add(const CoordsXY& loc, TileElementType type)
+{
+    // Anything placed now will be picked up by the rebuild
+    if (!_registryValid)
+        return;
+
+    auto* list = tile_element_registry_get_list(type);
+    if (list == nullptr)
+        return;
+
+    const TileCoordsXY tilePos{ loc };
+    auto it = std::lower_bound(list->Tiles.begin(), list->Tiles.end(), tilePos, tile_element_registry_is_before);
+    if (it == list->Tiles.end() || *it != tilePos)
+    {
+        list->Tiles.insert(it, tilePos);
+    }
+}
+
+void tile_element_registry_remove(TileElementType type)
+{
+    auto* list = tile_element_registry_get_list(type);
+    if (list != nullptr)
+    {
+        list->HasRemovals = true;
+    }
+}
+
+const std::vector<TileCoordsXY>& tile_element_registry_get(TileElementType type)
+{
+    static const std::vector<TileCoordsXY> noTiles;
+    auto* list = tile_element_registry_get_list(type);
+    if (list == nullptr)
+        return noTiles;
+
+    if (!_registryValid)
+    {
+        tile_element_registry_rebuild();
+    }
+    else if (list->HasRemovals)
+    {
+        auto& tiles = list->Tiles;
+        tiles.erase(
+            std::remove_if(
+                tiles.begin(), tiles.end(),
+                [type](const TileCoordsXY& tilePos) { return !tile_element_registry_tile_has_type(tilePos, type); }),
+            tiles.end());
+        list->HasRemovals = false;
+    }
+    return list->Tiles;
+}
@@ -0,0 +1,46 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+#include "Location.hpp"
+#include "TileElement.h"
+
+#include <vector>
+
+/*
+ * The tile element registry records which tiles hold elements of each type so that maintenance sweeps over a single
+ * type of element do not have to visit the whole map. Surface elements are not registered as every tile has one.
+ *
+ * A tile is recorded when an element of that type is inserted on it. Tiles are only dropped again lazily after elements
+ * of that type have been removed, so users must still check the type of every element on the returned tiles. Tiles are
+ * sorted in the order that tile_element_iterator visits them so results match a full map scan.
+ */
+
+/**
+ * Discards the registry, it will be rebuilt from the map the next time it is used. Called whenever the map is replaced.
+ */
+void tile_element_registry_invalidate();
+
+/**
+ * Records that an element of the given type has been placed at the given location.
+ */
+void tile_element_registry_add(const CoordsXY& loc, TileElementType type);
+
+/**
+ * Notes that an element of the given type has been removed, tiles no longer holding any element of that type will be
+ * dropped the next time the type is queried.
+ */
+void tile_element_registry_remove(TileElementType type);
+
+/**
+ * All tiles that may contain elements of the given type.
+ */
+const std::vector<TileCoordsXY>& tile_element_registry_get(TileElementType type);
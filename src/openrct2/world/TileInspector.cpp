@@ -17,6 +17,8 @@
 #include "../interface/Window.h"
 #include "../interface/Window_internal.h"
 #include "../localisation/Localisation.h"
+#include "../ride/RideGeometryCache.h"
+#include "../ride/RideTileIndex.h"
 #include "../ride/Station.h"
 #include "../ride/Track.h"
 #include "../ride/TrackData.h"
@@ -29,6 +31,7 @@
 #include "Park.h"
 #include "Scenery.h"
 #include "Surface.h"
+#include "TileElementRegistry.h"
 
 #include <algorithm>
 #include <optional>
@@ -62,6 +65,7 @@ namespace OpenRCT2::TileInspector
 
         // Swap their memory
         std::swap(*firstElement, *secondElement);
+        ride_geometry_cache_invalidate_tile(loc);
 
         // Swap the 'last map element for tile' flag if either one of them was last
         if ((firstElement)->IsLastForTile() || (secondElement)->IsLastForTile())
@@ -394,6 +398,8 @@ namespace OpenRCT2::TileInspector
             bool lastForTile = pastedElement->IsLastForTile();
             *pastedElement = element;
             pastedElement->SetLastForTile(lastForTile);
+            ride_tile_index_add_element(loc, pastedElement);
+            tile_element_registry_add(loc, static_cast<TileElementType>(pastedElement->GetType()));
 
             map_invalidate_tile_full(loc);
 
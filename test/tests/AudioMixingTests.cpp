@@ -0,0 +1,85 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <openrct2/audio/AudioMixing.h>
+#include <vector>
+
+using namespace OpenRCT2::Audio;
+
+static std::vector<int16_t> CreateSamples(size_t count)
+{
+    std::vector<int16_t> samples(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        samples[i] = static_cast<int16_t>((i * 7919) % 65536 - 32768);
+    }
+    return samples;
+}
+
+TEST(AudioMixingTest, UnityGainAddsSamples)
+{
+    std::vector<int16_t> src = { 100, -200, 300, -400, 500, -600, 700, -800, 900, -1000 };
+    std::vector<int16_t> dst = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+    MixS16(dst.data(), src.data(), src.size() / 2, 2, MixGain{}, MixGain{});
+    for (size_t i = 0; i < src.size(); i++)
+    {
+        ASSERT_EQ(dst[i], static_cast<int16_t>(src[i] + static_cast<int16_t>(i + 1)));
+    }
+}
+
+TEST(AudioMixingTest, Saturates)
+{
+    std::vector<int16_t> src(32, 30000);
+    std::vector<int16_t> dst(32, 30000);
+    MixS16(dst.data(), src.data(), src.size(), 1, MixGain{}, MixGain{});
+    for (auto sample : dst)
+    {
+        ASSERT_EQ(sample, INT16_MAX);
+    }
+
+    std::fill(src.begin(), src.end(), -30000);
+    std::fill(dst.begin(), dst.end(), -30000);
+    MixS16(dst.data(), src.data(), src.size(), 1, MixGain{}, MixGain{});
+    for (auto sample : dst)
+    {
+        ASSERT_EQ(sample, INT16_MIN);
+    }
+}
+
+TEST(AudioMixingTest, MatchesScalar)
+{
+    MixGain start;
+    start.Left = 0.9f;
+    start.Right = 0.1f;
+    MixGain end;
+    end.Left = 0.2f;
+    end.Right = 0.7f;
+
+    // Use frame counts that do not divide evenly into the vector width
+    for (int32_t numChannels = 1; numChannels <= 2; numChannels++)
+    {
+        for (size_t numFrames : { 1, 3, 7, 8, 13, 2048, 2051 })
+        {
+            auto src = CreateSamples(numFrames * numChannels);
+            auto expected = CreateSamples(numFrames * numChannels);
+            std::reverse(expected.begin(), expected.end());
+            auto actual = expected;
+
+            MixS16Scalar(expected.data(), src.data(), numFrames, numChannels, start, end);
+            MixS16(actual.data(), src.data(), numFrames, numChannels, start, end);
+            for (size_t i = 0; i < expected.size(); i++)
+            {
+                // Allow for rounding differences in the accumulated gain
+                ASSERT_NEAR(actual[i], expected[i], 1) << "channels: " << numChannels << ", frames: " << numFrames;
+            }
+        }
+    }
+}
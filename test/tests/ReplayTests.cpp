@@ -9,20 +9,28 @@
 
 #include "TestData.h"
 
+#include <algorithm>
 #include <gtest/gtest.h>
+#include <iterator>
 #include <openrct2/Context.h>
 #include <openrct2/Game.h>
 #include <openrct2/GameState.h>
 #include <openrct2/OpenRCT2.h>
+#include <openrct2/ParkImporter.h>
+#include <openrct2/PlatformEnvironment.h>
 #include <openrct2/ReplayManager.h>
+#include <openrct2/actions/StaffHireNewAction.h>
 #include <openrct2/audio/AudioContext.h>
 #include <openrct2/core/File.h>
 #include <openrct2/core/FileScanner.h>
 #include <openrct2/core/Path.hpp>
 #include <openrct2/core/String.hpp>
+#include <openrct2/object/ObjectManager.h>
 #include <openrct2/platform/platform.h>
 #include <openrct2/ride/Ride.h>
+#include <openrct2/world/Map.h>
 #include <string>
+#include <vector>
 
 using namespace OpenRCT2;
 
@@ -116,3 +124,193 @@ struct PrintReplayParameter
 };
 
 INSTANTIATE_TEST_CASE_P(Replay, ReplayTests, testing::ValuesIn(GetReplayFiles()), PrintReplayParameter());
+
+// Recordings write a chunk of records every 2400 ticks and a keyframe every 12000 ticks.
+static constexpr uint32_t ReplayChunkTicks = 40 * 60;
+static constexpr uint32_t ReplayKeyframeTicks = ReplayChunkTicks * 5;
+
+// Layout of a recording: magic and version, then chunks of a type, first tick, last tick, uncompressed size and compressed
+// size followed by the compressed data, all big endian.
+static constexpr size_t ReplayFileHeaderSize = 4 + 2;
+static constexpr size_t ReplayChunkHeaderSize = 1 + 4 + 4 + 4 + 4;
+static constexpr uint8_t ReplayChunkTypeRecords = 1;
+static constexpr uint8_t ReplayChunkTypeIndex = 3;
+
+struct ReplayChunkInfo
+{
+    uint8_t Type;
+    uint32_t FirstTick;
+    uint32_t LastTick;
+    size_t Offset;
+    size_t Size;
+};
+
+static uint32_t ReadBigEndian32(const std::vector<uint8_t>& data, size_t offset)
+{
+    return (static_cast<uint32_t>(data[offset]) << 24) | (data[offset + 1] << 16) | (data[offset + 2] << 8)
+        | data[offset + 3];
+}
+
+static std::vector<ReplayChunkInfo> ReadReplayChunkInfos(const std::vector<uint8_t>& data)
+{
+    std::vector<ReplayChunkInfo> chunks;
+    size_t offset = ReplayFileHeaderSize;
+    while (data.size() - offset >= ReplayChunkHeaderSize)
+    {
+        ReplayChunkInfo chunk{};
+        chunk.Type = data[offset];
+        chunk.FirstTick = ReadBigEndian32(data, offset + 1);
+        chunk.LastTick = ReadBigEndian32(data, offset + 5);
+        chunk.Offset = offset;
+        chunk.Size = ReplayChunkHeaderSize + ReadBigEndian32(data, offset + 13);
+        if (chunk.Type == ReplayChunkTypeIndex || data.size() - offset < chunk.Size)
+            break;
+
+        chunks.push_back(chunk);
+        offset += chunk.Size;
+    }
+    return chunks;
+}
+
+class ReplayRecordingTests : public testing::Test
+{
+protected:
+    std::unique_ptr<IContext> _context;
+    std::string _replayPath;
+
+    void SetUp() override
+    {
+        gOpenRCT2Headless = true;
+        gOpenRCT2NoGraphics = true;
+        core_init();
+
+        _context = CreateContext();
+        ASSERT_TRUE(_context->Initialise());
+
+        auto parkPath = TestData::GetParkPath("small_park_with_ferris_wheel.sv6");
+        auto importer = ParkImporter::CreateS6(_context->GetObjectRepository());
+        auto loadResult = importer->LoadSavedGame(parkPath.c_str(), false);
+        _context->GetObjectManager().LoadObjects(loadResult.RequiredObjects.data(), loadResult.RequiredObjects.size());
+        importer->Import();
+        map_reorganise_elements();
+
+        auto replayDirectory = _context->GetPlatformEnvironment()->GetDirectoryPath(DIRBASE::USER, DIRID::REPLAY);
+        Path::CreateDirectory(replayDirectory);
+        _replayPath = Path::Combine(replayDirectory, "test_recording.sv6r");
+    }
+
+    void TearDown() override
+    {
+        File::Delete(_replayPath);
+        _context.reset();
+    }
+
+    /**
+     * Records the given number of ticks. A staff member is hired between the frames of the tick the keyframe is saved
+     * at, like an action of a player would be.
+     */
+    void Record(uint32_t ticks)
+    {
+        auto* gs = _context->GetGameState();
+        auto* replayManager = _context->GetReplayManager();
+        ASSERT_TRUE(replayManager->StartRecording(_replayPath, ticks));
+
+        uint32_t keyframeTick = gCurrentTicks + ReplayKeyframeTicks;
+        while (replayManager->IsRecording())
+        {
+            if (gCurrentTicks == keyframeTick)
+            {
+                StaffHireNewAction action(true, StaffType::Handyman, EntertainerCostume::Panda, 0);
+                GameActions::Execute(&action);
+            }
+            gs->UpdateLogic();
+        }
+    }
+
+    /**
+     * Plays the current replay to its end, returns false if the state did not match the recording.
+     */
+    bool PlayToEnd()
+    {
+        auto* gs = _context->GetGameState();
+        auto* replayManager = _context->GetReplayManager();
+        while (replayManager->IsReplaying())
+        {
+            gs->UpdateLogic();
+            if (replayManager->IsPlaybackStateMismatching())
+                return false;
+        }
+        return true;
+    }
+};
+
+TEST_F(ReplayRecordingTests, PlaysBackChunkedRecording)
+{
+    Record(ReplayChunkTicks * 2 + 100);
+
+    auto* replayManager = _context->GetReplayManager();
+    ASSERT_TRUE(replayManager->StartPlayback(_replayPath));
+    uint32_t startTick = gCurrentTicks;
+    ASSERT_TRUE(PlayToEnd());
+    ASSERT_GE(gCurrentTicks - startTick, ReplayChunkTicks * 2 + 100);
+}
+
+TEST_F(ReplayRecordingTests, PlaysTruncatedRecordingToLastChunk)
+{
+    Record(ReplayChunkTicks * 2 + 100);
+
+    // Cut the file short in the middle of the end chunk, the index and trailer come after it and the trailer ends with
+    // the offset of the index followed by its magic.
+    auto data = File::ReadAllBytes(_replayPath);
+    ASSERT_GT(data.size(), 12U);
+    uint64_t indexOffset = 0;
+    for (size_t i = data.size() - 12; i < data.size() - 4; i++)
+    {
+        indexOffset = (indexOffset << 8) | data[i];
+    }
+    ASSERT_LT(indexOffset, data.size());
+    File::WriteAllBytes(_replayPath, data.data(), static_cast<size_t>(indexOffset - 1));
+
+    auto* replayManager = _context->GetReplayManager();
+    ASSERT_TRUE(replayManager->StartPlayback(_replayPath));
+    uint32_t startTick = gCurrentTicks;
+    ASSERT_TRUE(PlayToEnd());
+    ASSERT_GE(gCurrentTicks - startTick, ReplayChunkTicks * 2 + 100);
+}
+
+TEST_F(ReplayRecordingTests, PlaysTruncatedRecordingToPreviousChunk)
+{
+    Record(ReplayChunkTicks * 2 + 100);
+
+    // Cut the file short in the middle of the last records chunk, playback has to stop at the end of the one before it
+    auto data = File::ReadAllBytes(_replayPath);
+    auto chunks = ReadReplayChunkInfos(data);
+    std::vector<ReplayChunkInfo> recordsChunks;
+    std::copy_if(chunks.begin(), chunks.end(), std::back_inserter(recordsChunks), [](const ReplayChunkInfo& chunk) {
+        return chunk.Type == ReplayChunkTypeRecords;
+    });
+    ASSERT_GE(recordsChunks.size(), 2U);
+    const auto& lastChunk = recordsChunks[recordsChunks.size() - 1];
+    const auto& previousChunk = recordsChunks[recordsChunks.size() - 2];
+    File::WriteAllBytes(_replayPath, data.data(), lastChunk.Offset + lastChunk.Size / 2);
+
+    auto* replayManager = _context->GetReplayManager();
+    ASSERT_TRUE(replayManager->StartPlayback(_replayPath));
+    ASSERT_TRUE(PlayToEnd());
+    // The last tick replayed has been simulated, so the tick counter has moved on by one
+    ASSERT_EQ(gCurrentTicks - 1, previousChunk.LastTick);
+}
+
+TEST_F(ReplayRecordingTests, SeeksThroughKeyframe)
+{
+    Record(ReplayKeyframeTicks + ReplayChunkTicks);
+
+    auto* replayManager = _context->GetReplayManager();
+    ASSERT_TRUE(replayManager->StartPlayback(_replayPath));
+    uint32_t startTick = gCurrentTicks;
+    ASSERT_TRUE(replayManager->Seek(ReplayKeyframeTicks + 100));
+    ASSERT_TRUE(replayManager->IsReplaying());
+    ASSERT_FALSE(replayManager->IsPlaybackStateMismatching());
+    ASSERT_EQ(gCurrentTicks - startTick, ReplayKeyframeTicks + 100);
+    ASSERT_TRUE(PlayToEnd());
+}
@@ -67,6 +67,28 @@ protected:
         auto result = memcmp(chunk->GetData(), randomdata, sizeof(randomdata));
         ASSERT_EQ(result, 0);
     }
+
+    void test_decode_into(const uint8_t* data, size_t size)
+    {
+        // Destination smaller than the chunk, only the start is decoded
+        uint8_t prefix[100];
+        OpenRCT2::MemoryStream ms(data, size);
+        SawyerChunkReader reader(&ms);
+        reader.ReadChunk(prefix, sizeof(prefix));
+        ASSERT_EQ(ms.GetPosition(), size);
+        ASSERT_EQ(memcmp(prefix, randomdata, sizeof(prefix)), 0);
+
+        // Destination larger than the chunk, the rest is padded with zero
+        uint8_t padded[sizeof(randomdata) + 100];
+        std::fill_n(padded, sizeof(padded), 0xFF);
+        ms.SetPosition(0);
+        reader.ReadChunk(padded, sizeof(padded));
+        ASSERT_EQ(memcmp(padded, randomdata, sizeof(randomdata)), 0);
+        for (size_t i = sizeof(randomdata); i < sizeof(padded); i++)
+        {
+            ASSERT_EQ(padded[i], 0);
+        }
+    }
 };
 
 TEST_F(SawyerCodingTest, write_read_chunk_none)
@@ -114,6 +136,26 @@ TEST_F(SawyerCodingTest, decode_chunk_rotate)
     test_decode(rotatedata, sizeof(rotatedata));
 }
 
+TEST_F(SawyerCodingTest, decode_chunk_into_none)
+{
+    test_decode_into(nonedata, sizeof(nonedata));
+}
+
+TEST_F(SawyerCodingTest, decode_chunk_into_rle)
+{
+    test_decode_into(rledata, sizeof(rledata));
+}
+
+TEST_F(SawyerCodingTest, decode_chunk_into_rlecompressed)
+{
+    test_decode_into(rlecompresseddata, sizeof(rlecompresseddata));
+}
+
+TEST_F(SawyerCodingTest, decode_chunk_into_rotate)
+{
+    test_decode_into(rotatedata, sizeof(rotatedata));
+}
+
 TEST_F(SawyerCodingTest, invalid1)
 {
     OpenRCT2::MemoryStream ms(invalid1, sizeof(invalid1));